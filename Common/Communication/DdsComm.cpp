@@ -1,4 +1,5 @@
 #include "DdsComm.h"
+#include <sstream>
 
 namespace AIEP {
 DdsComm::DdsComm() {
@@ -17,15 +18,39 @@ bool DdsComm::Initialize()
 }
 
 void DdsComm::RegisterWriters() {
-    // 송신용 Writer들 등록
-    dds.RegisterWriter<AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST>();
-    dds.RegisterWriter<AIEP_M_MINE_EP_RESULT>();
-    dds.RegisterWriter<AIEP_ALM_ASM_EP_RESULT>();
-    dds.RegisterWriter<AIEP_ASSIGN_RESP>();
-    dds.RegisterWriter<AIEP_AI_INFER_RESULT_WP>();
-    dds.RegisterWriter<AIEP_INTERNAL_INFER_REQ>();
+    // 송신용 Writer들 등록 (Writer 별 송신 샘플 함께 할당)
+    RegisterWriter<AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST>();
+    RegisterWriter<AIEP_M_MINE_EP_RESULT>();
+    RegisterWriter<AIEP_ALM_ASM_EP_RESULT>();
+    RegisterWriter<AIEP_ASSIGN_RESP>();
+    RegisterWriter<AIEP_AI_INFER_RESULT_WP>();
+    RegisterWriter<AIEP_INTERNAL_INFER_REQ>();
+    RegisterWriter<AIEP_WPN_CTRL_STATUS_INFO>();
 }
 DdsComm::~DdsComm() {
 
 }
+
+DdsComm::ReaderStats* DdsComm::AddReaderStats(const std::string& topicName) {
+    std::lock_guard<std::mutex> lock(m_readerStatsMutex);
+    auto& stats = m_readerStats[topicName];
+    if (!stats) {
+        stats = std::make_unique<ReaderStats>();
+        stats->topicName = topicName;
+    }
+    return stats.get();
+}
+
+std::string DdsComm::BuildCallbackFilterReport() const {
+    std::lock_guard<std::mutex> lock(m_readerStatsMutex);
+
+    std::ostringstream report;
+    for (const auto& [topicName, stats] : m_readerStats) {
+        uint64_t received = stats->received.load(std::memory_order_relaxed);
+        uint64_t skipped = stats->skipped.load(std::memory_order_relaxed);
+        report << topicName << " received: " << received << ", callback skipped: " << skipped
+            << " (" << (received > 0 ? 100.0 * skipped / received : 0.0) << "%)\n";
+    }
+    return report.str();
+}
 }
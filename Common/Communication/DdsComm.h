@@ -2,14 +2,57 @@
 
 #include "../dds_message/AIEP_AIEP_.hpp"
 #include "../dds_library/dds.h"
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
 #include <iostream>
 
 // =============================================================================
 // RTI DDS 통신 관리 클래스
 // =============================================================================
 namespace AIEP {
+
+// 발사관 번호 기준 콜백 필터 (bit n = n번 발사관 콜백 호출)
+// 미들웨어 수준 필터(content-filtered topic)가 아니므로 다른 발사관 샘플도 수신/역직렬화됨
+struct TubeCallbackFilter {
+    uint64_t tubeMask{ 0 };
+
+    void Allow(int tubeNumber) {
+        if (tubeNumber >= 1 && tubeNumber < 64) {
+            tubeMask |= (uint64_t{ 1 } << tubeNumber);
+        }
+    }
+
+    bool Accepts(int tubeNumber) const {
+        return tubeNumber >= 1 && tubeNumber < 64 && (tubeMask & (uint64_t{ 1 } << tubeNumber)) != 0;
+    }
+};
+
+// 대여한 송신 샘플 (대여 중에는 같은 Writer 의 다른 생산자가 대기, DdsComm::Send 로 송신하면 반납)
+template <typename T>
+class LoanedSample {
+public:
+    LoanedSample(T& sample, std::unique_lock<std::mutex> lock)
+        : m_sample(&sample), m_lock(std::move(lock)) {}
+
+    LoanedSample(LoanedSample&&) = default;
+    LoanedSample& operator=(LoanedSample&&) = default;
+
+    T& operator*() { return *m_sample; }
+    T* operator->() { return m_sample; }
+
+private:
+    T* m_sample;
+    std::unique_lock<std::mutex> m_lock;
+};
+
 class DdsComm {
 public:
     DdsComm();
@@ -28,16 +71,92 @@ public:
         dds.Send(message);
     }
 
+    // 송신 샘플 대여: Writer 별로 미리 할당된 샘플을 그 자리에서 채워 송신 (임시 메시지 생성/복사 없음)
+    // 직전 송신 내용이 남아 있으므로 생산자는 송신할 필드를 모두 채워야 함
+    template <typename T>
+    LoanedSample<T> LoanSample()
+    {
+        OutboundSlot<T>& slot = GetOutboundSlot<T>();
+        return LoanedSample<T>(slot.sample, std::unique_lock<std::mutex>(slot.mutex));
+    }
+
+    // 대여 샘플 송신 후 반납
+    template <typename T>
+    void Send(LoanedSample<T>&& sample)
+    {
+        LoanedSample<T> loan(std::move(sample));
+        dds.Send(*loan);
+    }
+
     template<typename MessageType>
     void RegisterReader(std::function<void(const MessageType&)> callback) {
         dds.RegisterReader<MessageType>(callback);
         std::cout << "Reader registered for: " << typeid(MessageType).name() << std::endl;
     }
 
+    // 발사관 필터 Reader 등록: 역직렬화된 샘플 중 다른 발사관 샘플은 사용자 콜백을 호출하지 않음
+    // (수신/역직렬화 비용은 그대로, 콜백 처리와 로그만 생략) 토픽별 수신/생략 수 집계
+    template<typename MessageType, typename TubeAccessor>
+    void RegisterReader(std::function<void(const MessageType&)> callback, const TubeCallbackFilter& filter, TubeAccessor tubeOf) {
+        ReaderStats* stats = AddReaderStats(typeid(MessageType).name());
+        dds.RegisterReader<MessageType>([stats, filter, tubeOf, callback](const MessageType& message) {
+            stats->received.fetch_add(1, std::memory_order_relaxed);
+            if (!filter.Accepts(static_cast<int>(tubeOf(message)))) {
+                stats->skipped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            callback(message);
+            });
+        std::cout << "Filtered reader registered for: " << typeid(MessageType).name() << std::endl;
+    }
+
+    // 필터 Reader 토픽별 콜백 생략 통계 (토픽, 수신, 콜백 생략, 생략 비율)
+    std::string BuildCallbackFilterReport() const;
+
     // Writer 등록 (생성자에서 일괄 등록)
     void RegisterWriters();
 
 private:
+    // Writer 별 미리 할당된 송신 샘플
+    struct OutboundSlotBase {
+        virtual ~OutboundSlotBase() = default;
+    };
+
+    template <typename T>
+    struct OutboundSlot : OutboundSlotBase {
+        std::mutex mutex;
+        T sample;
+    };
+
+    // Writer 와 송신 샘플 등록 (생성자에서만 호출)
+    template <typename T>
+    void RegisterWriter()
+    {
+        dds.RegisterWriter<T>();
+        m_outboundSlots[std::type_index(typeid(T))] = std::make_unique<OutboundSlot<T>>();
+    }
+
+    template <typename T>
+    OutboundSlot<T>& GetOutboundSlot()
+    {
+        auto it = m_outboundSlots.find(std::type_index(typeid(T)));
+        if (it == m_outboundSlots.end()) {
+            throw std::logic_error(std::string("No writer registered for ") + typeid(T).name());
+        }
+        return static_cast<OutboundSlot<T>&>(*it->second);
+    }
+
+    struct ReaderStats {
+        std::string topicName;
+        std::atomic<uint64_t> received{ 0 };
+        std::atomic<uint64_t> skipped{ 0 };   // 콜백 전 생략 (역직렬화 후)
+    };
+
+    ReaderStats* AddReaderStats(const std::string& topicName);
+
     Dds dds;
+    std::map<std::type_index, std::unique_ptr<OutboundSlotBase>> m_outboundSlots;  // 생성 후 변경 없음 (잠금 없이 조회)
+    std::map<std::string, std::unique_ptr<ReaderStats>> m_readerStats;
+    mutable std::mutex m_readerStatsMutex;
 };
 }
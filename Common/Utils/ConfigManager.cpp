@@ -4,11 +4,51 @@
 #include <iostream>
 #include <algorithm>
 #include <filesystem>
+#include <sstream>
+#include <stdexcept>
 
 namespace MINEASMALM 
 {
-    // 기본 무장 제원 정의
-    const WeaponSpecification ConfigManager::s_defaultWeaponSpec;
+    namespace {
+        // 미지원 무장 조회 시 반환하는 기본 제원
+        const WeaponSpecification s_defaultWeaponSpec;
+
+        // 무장 섹션 스키마 (그 밖의 키는 오타일 수 있으므로 경고)
+        const std::set<std::string> s_weaponSectionKeys = {
+            "Name", "Description", "MaxRange", "MaxSpeed", "CruiseSpeed", "LaunchDelay", "MaxDepth", "MaxAltitude",
+            "MaxWaypoints", "RequiresWaypoints", "TrajectoryArrayLength", "BatteryCapacity", "PowerConsumptionCoefficient",
+            "EngagementPlanUpdateInterval", "PlanIntervalPlanning", "PlanIntervalReady", "PlanIntervalMaxBackoff",
+            "OwnshipJumpThreshold", "LaunchGeometryInterval", "ResultStatusInterval", "ResultFullRefreshInterval"
+        };
+
+        constexpr int MAX_TRAJECTORY_ARRAY_LENGTH = 128;    // 교전계획 결과 메시지 궤적 배열 크기 (C_TRAJECTORY_SIZE)
+        constexpr double MPS_TO_KNOT = 1.943844;
+
+        // 자항기뢰 축전지 제원 기본값 (설정 파일에 없을 때)
+        constexpr double M_MINE_DEFAULT_BATTERY_CAPACITY_WH = 16941.47;
+        constexpr double M_MINE_DEFAULT_POWER_CONSUMPTION_COEFFICIENT = 3.9219;
+    }
+
+    // =============================================================================
+    // ConfigSnapshot 구현
+    // =============================================================================
+
+    const WeaponSpecification& ConfigSnapshot::GetWeaponSpec(EN_WPN_KIND weaponKind) const {
+        auto it = weaponSpecs.find(weaponKind);
+        if (it != weaponSpecs.end()) {
+            return it->second;
+        }
+
+        return s_defaultWeaponSpec;
+    }
+
+    bool ConfigSnapshot::IsWeaponSupported(EN_WPN_KIND weaponKind) const {
+        return weaponSpecs.find(weaponKind) != weaponSpecs.end();
+    }
+
+    // =============================================================================
+    // ConfigManager 구현
+    // =============================================================================
 
     ConfigManager& ConfigManager::GetInstance() {
         static ConfigManager instance;
@@ -16,7 +56,7 @@ namespace MINEASMALM
     }
 
     bool ConfigManager::LoadFromFile(const std::string& configFilePath) {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        std::lock_guard<std::mutex> lock(m_loadMutex);
 
         ConfigReader config;
         if (!config.LoadFromFile(configFilePath)) {
@@ -24,45 +64,186 @@ namespace MINEASMALM
             return false;
         }
 
+        std::shared_ptr<const ConfigSnapshot> previous = m_snapshot.Load();
+        std::shared_ptr<const ConfigSnapshot> current;
         try {
-            // 각 섹션별 설정 로드
-            LoadSystemInfraConfig(config);
-            LoadBusinessLogicConfig(config);
-            LoadWeaponSpecs(config);
+            // 각 섹션별 설정을 새 스냅샷에 구성한 뒤 한 번에 교체 (구성 중 실패하면 기존 스냅샷 유지)
+            auto snapshot = std::make_shared<ConfigSnapshot>();
+            snapshot->sourcePath = configFilePath;
+            LoadSystemInfraConfig(config, *snapshot);
+            LoadBusinessLogicConfig(config, *snapshot);
+            LoadRealTimeConfig(config, *snapshot);
+            LoadLoggingConfig(config, *snapshot);
+            LoadWeaponSpecs(config, *snapshot);
+
+            // 숫자/불린 형식 오류가 있으면 기본값으로 대체하지 않고 로드 실패
+            if (!config.GetParseErrors().empty()) {
+                throw std::invalid_argument(std::to_string(config.GetParseErrors().size()) + " malformed value(s), first "
+                    + config.GetParseErrors().front());
+            }
 
-            m_loaded = true;
+            current = std::move(snapshot);
+            m_snapshot.Publish(current);
+            m_loaded.store(true);
 
             DEBUG_STREAM(CONFIGMANAGER) << "ConfigManager: All configurations loaded successfully from " << configFilePath << std::endl;
             DEBUG_STREAM(CONFIGMANAGER) << "- System infrastructure settings loaded" << std::endl;
             DEBUG_STREAM(CONFIGMANAGER) << "- Business logic settings loaded" << std::endl;
-            DEBUG_STREAM(CONFIGMANAGER) << "- Weapon specifications loaded: " << m_weaponSpecs.size() << " types" << std::endl;
-
-            return true;
+            DEBUG_STREAM(CONFIGMANAGER) << "- Weapon specifications loaded: " << current->weaponSpecs.size() << " types" << std::endl;
         }
         catch (const std::exception& e) {
             DEBUG_ERROR_STREAM(CONFIGMANAGER) << "Error loading configuration: " << e.what() << std::endl;
             return false;
         }
+
+        // 바뀐 항목이 있을 때만 통지 (로드 잠금 보유 중이므로 통지 순서는 교체 순서와 같음)
+        ConfigChange change = DiffSnapshots(std::move(previous), std::move(current));
+        if (change.HasChanges()) {
+            NotifyListeners(change);
+        }
+        return true;
+    }
+
+    int ConfigManager::Subscribe(ConfigChangeListener listener) {
+        std::lock_guard<std::mutex> lock(m_listenerMutex);
+        int subscriptionId = m_nextSubscriptionId++;
+        m_listeners.emplace(subscriptionId, std::move(listener));
+        return subscriptionId;
+    }
+
+    void ConfigManager::Unsubscribe(int subscriptionId) {
+        std::lock_guard<std::mutex> lock(m_listenerMutex);
+        m_listeners.erase(subscriptionId);
+    }
+
+    ConfigChange ConfigManager::DiffSnapshots(std::shared_ptr<const ConfigSnapshot> previous, std::shared_ptr<const ConfigSnapshot> current) const {
+        ConfigChange change;
+        change.systemInfraChanged = !(previous->systemInfra == current->systemInfra);
+        change.realTimeChanged = !(previous->realTime == current->realTime);
+        change.businessLogicChanged = !(previous->businessLogic == current->businessLogic);
+        change.loggingChanged = !(previous->logging == current->logging);
+
+        // 추가/변경된 무장과 삭제된 무장
+        for (const auto& [weaponKind, spec] : current->weaponSpecs) {
+            auto it = previous->weaponSpecs.find(weaponKind);
+            if (it == previous->weaponSpecs.end() || !(it->second == spec)) {
+                change.changedWeapons.insert(weaponKind);
+            }
+        }
+        for (const auto& [weaponKind, spec] : previous->weaponSpecs) {
+            if (current->weaponSpecs.find(weaponKind) == current->weaponSpecs.end()) {
+                change.changedWeapons.insert(weaponKind);
+            }
+        }
+
+        change.previous = std::move(previous);
+        change.current = std::move(current);
+        return change;
     }
 
-    void ConfigManager::LoadSystemInfraConfig(const ConfigReader& config) {
+    void ConfigManager::NotifyListeners(const ConfigChange& change) {
+        // 시작 시에만 적용되는 설정은 실행 중 반영하지 않음
+        if (change.systemInfraChanged || change.realTimeChanged) {
+            DEBUG_WARNING_STREAM(CONFIGMANAGER) << "[System]/[Network]/[RealTime] changes take effect after restart" << std::endl;
+        }
+
+        DEBUG_STREAM(CONFIGMANAGER) << "Configuration changed -"
+            << " business logic: " << (change.businessLogicChanged ? "yes" : "no")
+            << ", logging: " << (change.loggingChanged ? "yes" : "no")
+            << ", weapons: " << change.changedWeapons.size() << std::endl;
+
+        std::lock_guard<std::mutex> lock(m_listenerMutex);
+        for (const auto& [subscriptionId, listener] : m_listeners) {
+            try {
+                listener(change);
+            }
+            catch (const std::exception& e) {
+                DEBUG_ERROR_STREAM(CONFIGMANAGER) << "Configuration listener " << subscriptionId << " failed: " << e.what() << std::endl;
+            }
+        }
+    }
+
+    void ConfigManager::LoadSystemInfraConfig(const ConfigReader& config, ConfigSnapshot& snapshot) const {
+        SystemInfraConfig& systemInfra = snapshot.systemInfra;
+
         // 시스템 인프라 설정 로드
-        m_systemInfraConfig.totalTubes = config.GetInt("System", "TotalTubes", 6);
+        systemInfra.totalTubes = config.GetInt("System", "TotalTubes", 6);
+        systemInfra.multiTubeProcess = config.GetBool("System", "MultiTubeProcess", false);
+        systemInfra.shutdownTimeout_ms = std::max(0, config.GetInt("System", "ShutdownTimeoutMs", 50));
 
         // DDS 설정
-        m_systemInfraConfig.ddsDomainId = config.GetInt("Network", "DDSDomainId", 83);
+        systemInfra.ddsDomainId = config.GetInt("Network", "DDSDomainId", 83);
     }
 
-    void ConfigManager::LoadBusinessLogicConfig(const ConfigReader& config) {
+    void ConfigManager::LoadBusinessLogicConfig(const ConfigReader& config, ConfigSnapshot& snapshot) const {
+        BusinessLogicConfig& businessLogic = snapshot.businessLogic;
+
         // 업데이트 주기 설정
-        m_businessLogicConfig.engagementPlanUpdateInterval_sec = config.GetDouble("BusinessLogic", "EngagementPlanUpdateInterval", 1.0);
-        m_businessLogicConfig.weaponStatusUpdateInterval_sec = config.GetDouble("BusinessLogic", "WeaponStatusUpdateInterval", 1.0);
+        businessLogic.engagementPlanUpdateInterval_sec = config.GetDouble("BusinessLogic", "EngagementPlanUpdateInterval", 1.0);
+        businessLogic.weaponStatusUpdateInterval_sec = config.GetDouble("BusinessLogic", "WeaponStatusUpdateInterval", 1.0);
+
+        // 교전계획 작업 풀 (프로세스 시작 시에만 적용)
+        businessLogic.planningWorkerThreads = std::max(0, config.GetInt("BusinessLogic", "PlanningWorkerThreads", 0));
+        businessLogic.aiInferenceTimeout_sec = config.GetDouble("BusinessLogic", "AIInferenceTimeout", 5.0);
+    }
+
+    void ConfigManager::LoadRealTimeConfig(const ConfigReader& config, ConfigSnapshot& snapshot) const {
+        RealTimeConfig realTime;
+        realTime.lockMemory = config.GetBool("RealTime", "LockMemory", false);
+        realTime.prefaultStack_kb = config.GetInt("RealTime", "PrefaultStackKB", 0);
+        realTime.jitterReportFile = config.GetString("RealTime", "JitterReportFile", "");
+
+        // 역할별 키: <역할>.Policy, <역할>.Priority, <역할>.CPUs (예: Timer.Policy=FIFO, Timer.CPUs=2,3)
+        for (const std::string& key : config.GetKeysInSection("RealTime")) {
+            auto dot = key.find('.');
+            if (dot == std::string::npos) {
+                continue;
+            }
+
+            std::string role = key.substr(0, dot);
+            std::string field = key.substr(dot + 1);
+            ThreadRoleConfig& roleConfig = realTime.threadRoles[role];
+
+            if (field == "Policy") {
+                roleConfig.policy = config.GetString("RealTime", key, "OTHER");
+            }
+            else if (field == "Priority") {
+                roleConfig.priority = config.GetInt("RealTime", key, 0);
+            }
+            else if (field == "CPUs") {
+                std::stringstream cpuList(config.GetString("RealTime", key, ""));
+                std::string cpu;
+                while (std::getline(cpuList, cpu, ',')) {
+                    try {
+                        roleConfig.cpus.push_back(std::stoi(cpu));
+                    }
+                    catch (const std::exception&) {
+                        DEBUG_WARNING_STREAM(CONFIGMANAGER) << "Invalid CPU index in [RealTime] " << key << ": " << cpu << std::endl;
+                    }
+                }
+            }
+            else {
+                DEBUG_WARNING_STREAM(CONFIGMANAGER) << "Unknown [RealTime] key: " << key << std::endl;
+            }
+        }
+
+        snapshot.realTime = std::move(realTime);
+    }
+
+    void ConfigManager::LoadLoggingConfig(const ConfigReader& config, ConfigSnapshot& snapshot) const {
+        std::string level = config.GetString("Logging", "Level", "DEBUG");
+        std::transform(level.begin(), level.end(), level.begin(), ::toupper);
+        if (level != "DEBUG" && level != "WARNING" && level != "ERROR") {
+            DEBUG_WARNING_STREAM(CONFIGMANAGER) << "Unknown [Logging] Level: " << level << " (using DEBUG)" << std::endl;
+            level = "DEBUG";
+        }
+        snapshot.logging.level = level;
     }
 
-    void ConfigManager::LoadWeaponSpecs(const ConfigReader& config) {
+    void ConfigManager::LoadWeaponSpecs(const ConfigReader& config, ConfigSnapshot& snapshot) const {
         // 시스템 섹션들 (무장이 아닌 섹션들)
         std::set<std::string> systemSections = {
-            "System", "BusinessLogic", "Network", "Debug", "Logging", "DDS", "General"
+            "System", "BusinessLogic", "Network", "Debug", "Logging", "DDS", "General", "RealTime"
         };
 
         // 모든 섹션을 가져와서 시스템 섹션이 아닌 것들을 무장으로 간주
@@ -94,14 +275,40 @@ namespace MINEASMALM
             spec.maxAltitude_m = config.GetDouble(sectionName, "MaxAltitude", 1000.0);
             spec.maxWaypoints = config.GetInt(sectionName, "MaxWaypoints", 8);
             spec.requiresWaypoints = config.GetBool(sectionName, "RequiresWaypoints", true);
+            spec.trajectoryArrayLength = config.GetInt(sectionName, "TrajectoryArrayLength", MAX_TRAJECTORY_ARRAY_LENGTH);
             spec.description = config.GetString(sectionName, "Description", "");
 
+            // 축전지 제원 (자항기뢰만 기본값 있음)
+            bool isMine = (weaponKind == EN_WPN_KIND::WPN_KIND_M_MINE);
+            spec.batteryCapacity_Wh = config.GetDouble(sectionName, "BatteryCapacity", isMine ? M_MINE_DEFAULT_BATTERY_CAPACITY_WH : 0.0);
+            spec.powerConsumptionCoefficient = config.GetDouble(sectionName, "PowerConsumptionCoefficient",
+                isMine ? M_MINE_DEFAULT_POWER_CONSUMPTION_COEFFICIENT : 0.0);
+
+            // 교전계획 산출 주기 (미지정 시 BusinessLogic 주기)
+            double baseInterval_sec = snapshot.businessLogic.engagementPlanUpdateInterval_sec;
+            spec.engagementPlanUpdateInterval_sec = config.GetDouble(sectionName, "EngagementPlanUpdateInterval", baseInterval_sec);
+            spec.planIntervalPlanning_sec = config.GetDouble(sectionName, "PlanIntervalPlanning", baseInterval_sec);
+            spec.planIntervalReady_sec = config.GetDouble(sectionName, "PlanIntervalReady", baseInterval_sec);
+            spec.planIntervalMaxBackoff_sec = config.GetDouble(sectionName, "PlanIntervalMaxBackoff", 4.0 * baseInterval_sec);
+            spec.ownshipJumpThreshold_m = config.GetDouble(sectionName, "OwnshipJumpThreshold", 100.0);
+            spec.launchGeometryInterval_sec = config.GetDouble(sectionName, "LaunchGeometryInterval", baseInterval_sec);
+
+            // 교전계획 결과 송신 간격
+            spec.resultStatusInterval_sec = config.GetDouble(sectionName, "ResultStatusInterval", baseInterval_sec);
+            spec.resultFullRefreshInterval_sec = config.GetDouble(sectionName, "ResultFullRefreshInterval", 5.0);
+
             // 자항기뢰는 특별 처리 (경로점 필요 없음)
-            if (weaponKind == EN_WPN_KIND::WPN_KIND_M_MINE) {
+            if (isMine) {
                 spec.requiresWaypoints = false;
             }
 
-            m_weaponSpecs[weaponKind] = spec;
+            // 범위를 벗어난 제원이 있으면 로드 실패 (기존 스냅샷 유지)
+            if (!ValidateWeaponSpec(sectionName, config, spec)) {
+                throw std::invalid_argument("invalid weapon specification in [" + sectionName + "]");
+            }
+            ComputeDerivedConstants(spec);
+
+            snapshot.weaponSpecs[weaponKind] = spec;
 
             DEBUG_STREAM(CONFIGMANAGER) << "Loaded weapon spec: " << spec.name
                 << " [" << sectionName << "]"
@@ -109,40 +316,67 @@ namespace MINEASMALM
                 << "Speed: " << spec.maxSpeed_mps << "m/s)" << std::endl;
         }
 
-        if (m_weaponSpecs.empty()) {
+        if (snapshot.weaponSpecs.empty()) {
             DEBUG_WARNING_STREAM(CONFIGMANAGER) << "Warning: No weapon specifications loaded!" << std::endl;
         }
         else {
-            DEBUG_STREAM(CONFIGMANAGER) << "Total weapons loaded: " << m_weaponSpecs.size() << std::endl;
+            DEBUG_STREAM(CONFIGMANAGER) << "Total weapons loaded: " << snapshot.weaponSpecs.size() << std::endl;
         }
     }
 
-    const SystemInfraConfig& ConfigManager::GetSystemInfraConfig() const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        return m_systemInfraConfig;
-    }
-
-    const BusinessLogicConfig& ConfigManager::GetBusinessLogicConfig() const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        return m_businessLogicConfig;
-    }
+    bool ConfigManager::ValidateWeaponSpec(const std::string& sectionName, const ConfigReader& config, const WeaponSpecification& spec) const {
+        for (const std::string& key : config.GetKeysInSection(sectionName)) {
+            if (s_weaponSectionKeys.find(key) == s_weaponSectionKeys.end()) {
+                DEBUG_WARNING_STREAM(CONFIGMANAGER) << "Unknown key in [" << sectionName << "]: " << key << std::endl;
+            }
+        }
 
-    const WeaponSpecification& ConfigManager::GetWeaponSpec(EN_WPN_KIND weaponKind) const {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        bool valid = true;
+        auto require = [&](bool condition, const char* key, double value) {
+            if (!condition) {
+                DEBUG_ERROR_STREAM(CONFIGMANAGER) << "Out of range in [" << sectionName << "] " << key << ": " << value << std::endl;
+                valid = false;
+            }
+        };
 
-        auto it = m_weaponSpecs.find(weaponKind);
-        if (it != m_weaponSpecs.end()) {
-            return it->second;
-        }
+        require(spec.maxRange_km > 0.0, "MaxRange", spec.maxRange_km);
+        require(spec.maxSpeed_mps > 0.0, "MaxSpeed", spec.maxSpeed_mps);
+        require(spec.cruiseSpeed_mps >= 0.0, "CruiseSpeed", spec.cruiseSpeed_mps);
+        require(spec.launchDelay_sec >= 0.0, "LaunchDelay", spec.launchDelay_sec);
+        require(spec.maxDepth_m >= 0.0, "MaxDepth", spec.maxDepth_m);
+        require(spec.maxAltitude_m >= 0.0, "MaxAltitude", spec.maxAltitude_m);
+        require(spec.maxWaypoints >= 0, "MaxWaypoints", spec.maxWaypoints);
+        require(spec.trajectoryArrayLength >= 2 && spec.trajectoryArrayLength <= MAX_TRAJECTORY_ARRAY_LENGTH,
+            "TrajectoryArrayLength", spec.trajectoryArrayLength);
+        require(spec.batteryCapacity_Wh >= 0.0, "BatteryCapacity", spec.batteryCapacity_Wh);
+        require(spec.powerConsumptionCoefficient >= 0.0, "PowerConsumptionCoefficient", spec.powerConsumptionCoefficient);
+        require(spec.engagementPlanUpdateInterval_sec > 0.0, "EngagementPlanUpdateInterval", spec.engagementPlanUpdateInterval_sec);
+        require(spec.planIntervalPlanning_sec > 0.0, "PlanIntervalPlanning", spec.planIntervalPlanning_sec);
+        require(spec.planIntervalReady_sec > 0.0, "PlanIntervalReady", spec.planIntervalReady_sec);
+        require(spec.planIntervalMaxBackoff_sec > 0.0, "PlanIntervalMaxBackoff", spec.planIntervalMaxBackoff_sec);
+        require(spec.ownshipJumpThreshold_m >= 0.0, "OwnshipJumpThreshold", spec.ownshipJumpThreshold_m);
+        require(spec.launchGeometryInterval_sec > 0.0, "LaunchGeometryInterval", spec.launchGeometryInterval_sec);
+        require(spec.resultStatusInterval_sec >= 0.0, "ResultStatusInterval", spec.resultStatusInterval_sec);
+        require(spec.resultFullRefreshInterval_sec > 0.0, "ResultFullRefreshInterval", spec.resultFullRefreshInterval_sec);
+
+        // 최대 사거리 주행 시간이 0.1 sec 단위 기동 횟수(int)로 표현되어야 함
+        require(spec.maxSpeed_mps <= 0.0 || spec.maxRange_km * 1000.0 / spec.maxSpeed_mps * 10.0 < 2.0e9, "MaxRange", spec.maxRange_km);
+
+        return valid;
+    }
 
-        return s_defaultWeaponSpec;
+    void ConfigManager::ComputeDerivedConstants(WeaponSpecification& spec) const {
+        spec.maxSpeed_kn = spec.maxSpeed_mps * MPS_TO_KNOT;
+        spec.maxRunSteps_x10 = static_cast<int>(spec.maxRange_km * 1000.0 / spec.maxSpeed_mps * 10.0);
+        spec.energyConsumption_WhPerSec = (spec.powerConsumptionCoefficient / 3600.0)
+            * spec.maxSpeed_kn * spec.maxSpeed_kn * spec.maxSpeed_kn;
     }
 
     std::vector<EN_WPN_KIND> ConfigManager::GetSupportedWeaponKinds() const {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        auto snapshot = GetSnapshot();
 
         std::vector<EN_WPN_KIND> supportedKinds;
-        for (const auto& pair : m_weaponSpecs) {
+        for (const auto& pair : snapshot->weaponSpecs) {
             supportedKinds.push_back(pair.first);
         }
 
@@ -150,53 +384,79 @@ namespace MINEASMALM
     }
 
     bool ConfigManager::IsWeaponSupported(EN_WPN_KIND weaponKind) const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        return m_weaponSpecs.find(weaponKind) != m_weaponSpecs.end();
+        return GetSnapshot()->IsWeaponSupported(weaponKind);
     }
 
     std::string ConfigManager::GetWeaponName(EN_WPN_KIND weaponKind) const {
-        const auto& spec = GetWeaponSpec(weaponKind);
-        return spec.name;
+        return GetSnapshot()->GetWeaponSpec(weaponKind).name;
     }
 
     void ConfigManager::PrintAllConfigs() const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        std::cout << "\n========== System Infrastructure Configuration ==========" << std::endl;
-        std::cout << "[Basic Settings]" << std::endl;
-        std::cout << "  Total Tubes: " << m_systemInfraConfig.totalTubes << std::endl;
-
-        std::cout << "\n[DDS Settings]" << std::endl;
-        std::cout << "  Domain ID: " << m_systemInfraConfig.ddsDomainId << std::endl;
-
-        std::cout << "\n========== Business Logic Configuration ==========" << std::endl;
-        std::cout << "[Update Intervals]" << std::endl;
-        std::cout << "  Engagement Plan Update: " << m_businessLogicConfig.engagementPlanUpdateInterval_sec << " sec" << std::endl;
-        std::cout << "  Weapon Status Update: " << m_businessLogicConfig.weaponStatusUpdateInterval_sec << " sec" << std::endl;
+        auto snapshot = GetSnapshot();
+
+        DEBUG_STREAM(CONFIGMANAGER) << "\n========== System Infrastructure Configuration ==========" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "[Basic Settings]" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "  Total Tubes: " << snapshot->systemInfra.totalTubes << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "  Multi-Tube Process: " << (snapshot->systemInfra.multiTubeProcess ? "Yes" : "No") << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "  Shutdown Timeout: " << snapshot->systemInfra.shutdownTimeout_ms << " ms" << std::endl;
+
+        DEBUG_STREAM(CONFIGMANAGER) << "\n[DDS Settings]" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "  Domain ID: " << snapshot->systemInfra.ddsDomainId << std::endl;
+
+        DEBUG_STREAM(CONFIGMANAGER) << "\n========== Business Logic Configuration ==========" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "[Update Intervals]" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "  Engagement Plan Update: " << snapshot->businessLogic.engagementPlanUpdateInterval_sec << " sec" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "  Weapon Status Update: " << snapshot->businessLogic.weaponStatusUpdateInterval_sec << " sec" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "  AI Inference Timeout: " << snapshot->businessLogic.aiInferenceTimeout_sec << " sec" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "[Planning Work Pool]" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "  Worker Threads: " << snapshot->businessLogic.planningWorkerThreads << " (0 = CPU cores)" << std::endl;
+
+        DEBUG_STREAM(CONFIGMANAGER) << "\n========== Logging Configuration ==========" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "  Level: " << snapshot->logging.level << std::endl;
+
+        DEBUG_STREAM(CONFIGMANAGER) << "\n========== Real-Time Configuration ==========" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "  Lock Memory: " << (snapshot->realTime.lockMemory ? "Yes" : "No") << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "  Prefault Stack: " << snapshot->realTime.prefaultStack_kb << " KB" << std::endl;
+        for (const auto& [role, roleConfig] : snapshot->realTime.threadRoles) {
+            DEBUG_STREAM(CONFIGMANAGER) << "  [" << role << "] " << roleConfig.policy << " priority " << roleConfig.priority
+                << ", CPUs: " << roleConfig.cpus.size() << std::endl;
+        }
 
-        std::cout << "\n========== Weapon Specifications ==========" << std::endl;
-        if (m_weaponSpecs.empty()) {
-            std::cout << "No weapon specifications loaded." << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "\n========== Weapon Specifications ==========" << std::endl;
+        if (snapshot->weaponSpecs.empty()) {
+            DEBUG_STREAM(CONFIGMANAGER) << "No weapon specifications loaded." << std::endl;
         }
         else {
-            for (const auto& pair : m_weaponSpecs) {
+            for (const auto& pair : snapshot->weaponSpecs) {
                 const auto& spec = pair.second;
-                std::cout << "\n[" << WeaponKindToString(pair.first) << "] " << spec.name << std::endl;
-                std::cout << "  Max Range: " << spec.maxRange_km << " km" << std::endl;
-                std::cout << "  Max Speed: " << spec.maxSpeed_mps << " m/s" << std::endl;
-                std::cout << "  Cruise Speed: " << spec.cruiseSpeed_mps << " m/s" << std::endl;
-                std::cout << "  Launch Delay: " << spec.launchDelay_sec << " sec" << std::endl;
-                std::cout << "  Max Depth: " << spec.maxDepth_m << " m" << std::endl;
-                std::cout << "  Max Altitude: " << spec.maxAltitude_m << " m" << std::endl;
-                std::cout << "  Max Waypoints: " << spec.maxWaypoints << std::endl;
-                std::cout << "  Requires Waypoints: " << (spec.requiresWaypoints ? "Yes" : "No") << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "\n[" << WeaponKindToString(pair.first) << "] " << spec.name << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Max Range: " << spec.maxRange_km << " km" << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Max Speed: " << spec.maxSpeed_mps << " m/s" << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Cruise Speed: " << spec.cruiseSpeed_mps << " m/s" << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Launch Delay: " << spec.launchDelay_sec << " sec" << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Max Depth: " << spec.maxDepth_m << " m" << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Max Altitude: " << spec.maxAltitude_m << " m" << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Max Waypoints: " << spec.maxWaypoints << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Requires Waypoints: " << (spec.requiresWaypoints ? "Yes" : "No") << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Plan Interval (planning/ready/max backoff): " << spec.planIntervalPlanning_sec << " / "
+                    << spec.planIntervalReady_sec << " / " << spec.planIntervalMaxBackoff_sec << " sec" << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Ownship Jump Threshold: " << spec.ownshipJumpThreshold_m << " m" << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Launch Geometry Interval: " << spec.launchGeometryInterval_sec << " sec" << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Result Send (status/full refresh): " << spec.resultStatusInterval_sec << " / "
+                    << spec.resultFullRefreshInterval_sec << " sec" << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Post-Launch Update Interval: " << spec.engagementPlanUpdateInterval_sec << " sec" << std::endl;
+                DEBUG_STREAM(CONFIGMANAGER) << "  Trajectory Points: " << spec.trajectoryArrayLength << std::endl;
+                if (spec.batteryCapacity_Wh > 0.0) {
+                    DEBUG_STREAM(CONFIGMANAGER) << "  Battery: " << spec.batteryCapacity_Wh << " Wh, " << spec.energyConsumption_WhPerSec
+                        << " Wh/s at max speed" << std::endl;
+                }
                 if (!spec.description.empty()) {
                     DEBUG_STREAM(CONFIGMANAGER) << "  Description: " << spec.description << std::endl;
                 }
             }
         }
 
-        std::cout << "=================================================================" << std::endl;
+        DEBUG_STREAM(CONFIGMANAGER) << "=================================================================" << std::endl;
     }
 
     std::string ConfigManager::WeaponKindToString(EN_WPN_KIND kind) const {
@@ -1,5 +1,13 @@
+#include <atomic>
+#include <functional>
 #include <string>
 #include <mutex>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "SnapshotCell.h"
 
 namespace MINEASMALM {
 
@@ -8,11 +16,17 @@ namespace MINEASMALM {
      */
     struct SystemInfraConfig {
         int totalTubes;                     // 전체 발사관 개수        
+        bool multiTubeProcess;              // 전체 발사관을 한 프로세스에서 운용 (DDS 참여자 공유)
         int ddsDomainId;                    // DDS 설정
+        int shutdownTimeout_ms;             // 종료 제한 시간 (초과 시 강제 종료, 0 이면 제한 없음)
 
         SystemInfraConfig()
             : totalTubes(6)
-            , ddsDomainId(83)        {}
+            , multiTubeProcess(false)
+            , ddsDomainId(83)
+            , shutdownTimeout_ms(50)        {}
+
+        bool operator==(const SystemInfraConfig&) const = default;
     };
 
     /**
@@ -23,16 +37,66 @@ namespace MINEASMALM {
         double engagementPlanUpdateInterval_sec;     // 교전계획 업데이트 주기
         double weaponStatusUpdateInterval_sec;       // 무장상태 업데이트 주기
 
+        int planningWorkerThreads;                   // 교전계획 공용 작업 풀 작업자 수 (0 이면 CPU 코어 수)
+        double aiInferenceTimeout_sec;               // AI 경로점 추론 결과 대기 시간
+
         BusinessLogicConfig()
             : engagementPlanUpdateInterval_sec(1.0)
-            , weaponStatusUpdateInterval_sec(1.0)        {}
+            , weaponStatusUpdateInterval_sec(1.0)
+            , planningWorkerThreads(0)
+            , aiInferenceTimeout_sec(5.0)        {}
+
+        bool operator==(const BusinessLogicConfig&) const = default;
+    };
+
+    /**
+     * @brief 스레드 역할별 실시간 실행 설정 ([RealTime] 섹션의 <역할>.Policy / .Priority / .CPUs)
+     */
+    struct ThreadRoleConfig {
+        std::string policy;                 // OTHER, FIFO, RR
+        int priority;                       // FIFO/RR 우선순위 (1~99)
+        std::vector<int> cpus;              // 고정할 CPU 목록 (비어 있으면 고정 안 함)
+
+        ThreadRoleConfig()
+            : policy("OTHER"), priority(0)  {}
+
+        bool operator==(const ThreadRoleConfig&) const = default;
+    };
+
+    /**
+     * @brief 실시간 실행 설정 (프로세스 전체)
+     */
+    struct RealTimeConfig {
+        bool lockMemory;                    // mlockall(MCL_CURRENT | MCL_FUTURE)
+        int prefaultStack_kb;               // 스레드 시작 시 미리 접근해 둘 스택 크기
+        std::string jitterReportFile;       // 종료 시 주기 지터 보고서 파일 (비어 있으면 기록 안 함)
+        std::map<std::string, ThreadRoleConfig> threadRoles;
+
+        RealTimeConfig()
+            : lockMemory(false), prefaultStack_kb(0), jitterReportFile("")        {}
+
+        bool operator==(const RealTimeConfig&) const = default;
+    };
+
+    /**
+     * @brief 로그 설정 ([Logging] 섹션, 실행 중 변경 반영)
+     */
+    struct LoggingConfig {
+        std::string level;                  // DEBUG, WARNING, ERROR (이보다 낮은 수준은 출력 안 함)
+
+        LoggingConfig()
+            : level("DEBUG")        {}
+
+        bool operator==(const LoggingConfig&) const = default;
     };
 
     /**
      * @brief 무장 제원 정보
+     *
+     * 로드 시 스키마 검증 후 파생 상수까지 계산해 두므로 산출 주기에서는 필드만 읽습니다.
+     * 주기마다 읽는 수치 필드를 앞쪽에 모으고 문자열은 뒤에 둡니다.
      */
     struct WeaponSpecification {
-        std::string name;
         double maxRange_km;
         double maxSpeed_mps;
         double cruiseSpeed_mps;
@@ -41,43 +105,130 @@ namespace MINEASMALM {
         double maxAltitude_m;
         int maxWaypoints;
         bool requiresWaypoints;
+        int trajectoryArrayLength;          // 교전계획 결과 궤적 점 개수 (결과 메시지 궤적 배열 크기 이하)
+
+        // 축전지 제원 (자항기뢰)
+        double batteryCapacity_Wh;          // 만충 용량
+        double powerConsumptionCoefficient; // 속도 세제곱 비례 소모 계수 [Wh/h/knot^3]
+
+        // 교전계획 산출 주기 (발사 전 단계별, 발사 후는 engagementPlanUpdateInterval_sec 고정)
+        double engagementPlanUpdateInterval_sec;    // 발사 후 위치 추정 적분 간격
+        double planIntervalPlanning_sec;    // 교전계획 미준비 (계획 산출 중)
+        double planIntervalReady_sec;       // 교전계획 준비 완료 (발사 대기)
+        double planIntervalMaxBackoff_sec;  // 입력 변화가 없을 때 늘어나는 최대 주기
+        double ownshipJumpThreshold_m;      // 이 거리 이상 자함 위치 변화 시 즉시 재계획
+        double launchGeometryInterval_sec;  // 발사 가능 구역 판단 주기 (최신 항법 정보 기준, 발사 전)
+
+        // 교전계획 결과 송신 (계획 변경은 즉시, 상태 값 변경은 아래 주기로 송신)
+        double resultStatusInterval_sec;    // 상태 값(탄 위치, 잔여 시간 등)만 바뀐 경우 최소 송신 간격
+        double resultFullRefreshInterval_sec;   // 변경이 없어도 전체 결과를 다시 송신하는 간격 (늦게 참여한 수신측용)
+
+        // 파생 상수 (로드 시 계산, 직접 설정하지 않음)
+        double maxSpeed_kn;                 // 최대 속도 [knot]
+        int maxRunSteps_x10;                // 최대 사거리까지 최대 속도 주행 시간 (0.1 sec 단위 기동 횟수)
+        double energyConsumption_WhPerSec;  // 최대 속도 기동 시 초당 소모 전력량
+
+        std::string name;
         std::string description;
 
         WeaponSpecification()
-            : name("Unknown"), maxRange_km(0.0), maxSpeed_mps(0.0), cruiseSpeed_mps(0.0), launchDelay_sec(3.0)
-            , launchDelay_sec(0.0), maxDepth_m(0.0), maxAltitude_m(0.0)
-            , maxWaypoints(0), requiresWaypoints(false), description("") {}
+            : maxRange_km(0.0), maxSpeed_mps(0.0), cruiseSpeed_mps(0.0), launchDelay_sec(3.0)
+            , maxDepth_m(0.0), maxAltitude_m(0.0)
+            , maxWaypoints(0), requiresWaypoints(false), trajectoryArrayLength(128)
+            , batteryCapacity_Wh(0.0), powerConsumptionCoefficient(0.0)
+            , engagementPlanUpdateInterval_sec(1.0)
+            , planIntervalPlanning_sec(1.0), planIntervalReady_sec(1.0), planIntervalMaxBackoff_sec(4.0)
+            , ownshipJumpThreshold_m(100.0), launchGeometryInterval_sec(1.0)
+            , resultStatusInterval_sec(1.0), resultFullRefreshInterval_sec(5.0)
+            , maxSpeed_kn(0.0), maxRunSteps_x10(0), energyConsumption_WhPerSec(0.0)
+            , name("Unknown"), description("") {}
+
+        bool operator==(const WeaponSpecification&) const = default;
+    };
+
+    /**
+     * @brief 불변 설정 스냅샷 (로드 시 한 번 구성, 이후 변경 없음)
+     *
+     * 읽는 쪽은 스냅샷을 받아 들고 사용하며, 설정이 다시 로드되어도 이미 받은 스냅샷은 그대로 유지됩니다.
+     */
+    struct ConfigSnapshot {
+        SystemInfraConfig systemInfra;
+        BusinessLogicConfig businessLogic;
+        RealTimeConfig realTime;
+        LoggingConfig logging;
+        std::map<EN_WPN_KIND, WeaponSpecification> weaponSpecs;
+        std::string sourcePath;             // 로드한 설정 파일 (기본값이면 빈 문자열)
+
+        /**
+         * @brief 무장 제원 조회 (미지원 무장은 기본 제원)
+         */
+        const WeaponSpecification& GetWeaponSpec(EN_WPN_KIND weaponKind) const;
+
+        bool IsWeaponSupported(EN_WPN_KIND weaponKind) const;
     };
 
+    /**
+     * @brief 설정 변경 내역 (다시 로드 시 이전/새 스냅샷 비교 결과)
+     *
+     * 구독자는 자신에 해당하는 항목이 바뀐 경우에만 새 스냅샷을 반영합니다.
+     */
+    struct ConfigChange {
+        std::shared_ptr<const ConfigSnapshot> previous;
+        std::shared_ptr<const ConfigSnapshot> current;
+        bool systemInfraChanged{ false };       // 프로세스 구성 (재시작 후 반영)
+        bool realTimeChanged{ false };          // 스레드 시작 시 적용 (재시작 후 반영)
+        bool businessLogicChanged{ false };
+        bool loggingChanged{ false };
+        std::set<EN_WPN_KIND> changedWeapons;   // 제원이 추가/변경/삭제된 무장
+
+        bool IsWeaponChanged(EN_WPN_KIND weaponKind) const {
+            return changedWeapons.find(weaponKind) != changedWeapons.end();
+        }
+
+        bool HasChanges() const {
+            return systemInfraChanged || realTimeChanged || businessLogicChanged || loggingChanged || !changedWeapons.empty();
+        }
+    };
+
+    using ConfigChangeListener = std::function<void(const ConfigChange& change)>;
+
     /**
      * @brief 통합 설정 관리자 (실용적 접근법)
      *
      * 하나의 설정 파일에서 모든 설정을 로드하되,
      * 용도별로 구조화하여 제공합니다.
+     * 로드할 때마다 새 불변 스냅샷을 만들어 포인터만 교체하므로, 조회는 잠금 없이 스냅샷 포인터만 읽습니다.
      */
     class ConfigManager {
     public:
         static ConfigManager& GetInstance();
 
         /**
-         * @brief 설정 파일 로드
+         * @brief 설정 파일 로드 (프로세스 시작 시, 설정 파일 변경 시에만 호출)
+         *
+         * 파일 전체를 새 스냅샷으로 구성한 뒤 교체하며, 실패하면 기존 스냅샷을 유지합니다.
+         * 교체 후 바뀐 항목이 있으면 호출 스레드에서 구독자에게 변경 내역을 통지합니다.
          */
         bool LoadFromFile(const std::string& configFilePath = "config.ini");
 
         /**
-         * @brief 시스템 인프라 설정 조회 (main에서 사용)
+         * @brief 설정 변경 통지 구독
+         *
+         * 통지는 다시 로드한 스레드(파일 감시 스레드)에서 호출되므로 스냅샷 교체, 작업 제출 등 짧은 처리만 해야 하며,
+         * 통지 안에서 구독/해제하면 안 됩니다.
+         * @return 구독 ID (해제 시 사용)
          */
-        const SystemInfraConfig& GetSystemInfraConfig() const;
+        int Subscribe(ConfigChangeListener listener);
 
         /**
-         * @brief 비즈니스 로직 설정 조회 (Factory에서 사용)
+         * @brief 구독 해제 (진행 중인 통지가 있으면 끝날 때까지 대기, 반환 후 다시 호출되지 않음)
          */
-        const BusinessLogicConfig& GetBusinessLogicConfig() const;
+        void Unsubscribe(int subscriptionId);
 
         /**
-         * @brief 무장 제원 조회 (Factory에서 사용)
+         * @brief 현재 설정 스냅샷 (잠금 없음, 주기 작업은 받은 스냅샷을 들고 사용)
          */
-        const WeaponSpecification& GetWeaponSpec(EN_WPN_KIND weaponKind) const;
+        std::shared_ptr<const ConfigSnapshot> GetSnapshot() const { return m_snapshot.Load(); }
 
         /**
          * @brief 지원되는 무장 종류 목록
@@ -97,7 +248,7 @@ namespace MINEASMALM {
         /**
          * @brief 설정 로드 여부 확인
          */
-        bool IsLoaded() const { return m_loaded; }
+        bool IsLoaded() const { return m_loaded.load(); }
 
         /**
          * @brief 설정 정보 출력
@@ -111,20 +262,28 @@ namespace MINEASMALM {
         ConfigManager(const ConfigManager&) = delete;
         ConfigManager& operator=(const ConfigManager&) = delete;
 
-        void LoadSystemInfraConfig(const ConfigReader& config);
-        void LoadBusinessLogicConfig(const ConfigReader& config);
-        void LoadWeaponSpecs(const ConfigReader& config);
+        void LoadSystemInfraConfig(const ConfigReader& config, ConfigSnapshot& snapshot) const;
+        void LoadBusinessLogicConfig(const ConfigReader& config, ConfigSnapshot& snapshot) const;
+        void LoadRealTimeConfig(const ConfigReader& config, ConfigSnapshot& snapshot) const;
+        void LoadLoggingConfig(const ConfigReader& config, ConfigSnapshot& snapshot) const;
+        void LoadWeaponSpecs(const ConfigReader& config, ConfigSnapshot& snapshot) const;
+        bool ValidateWeaponSpec(const std::string& sectionName, const ConfigReader& config, const WeaponSpecification& spec) const;
+        void ComputeDerivedConstants(WeaponSpecification& spec) const;
+
+        ConfigChange DiffSnapshots(std::shared_ptr<const ConfigSnapshot> previous, std::shared_ptr<const ConfigSnapshot> current) const;
+        void NotifyListeners(const ConfigChange& change);
 
         std::string WeaponKindToString(EN_WPN_KIND kind) const;
         EN_WPN_KIND StringToWeaponKind(const std::string& str) const;
 
-        SystemInfraConfig m_systemInfraConfig;
-        BusinessLogicConfig m_businessLogicConfig;
-        std::map<EN_WPN_KIND, WeaponSpecification> m_weaponSpecs;
+        AIEP::SnapshotCell<ConfigSnapshot> m_snapshot;   // 로드 전에는 기본값 스냅샷
 
-        mutable std::mutex m_mutex;
-        bool m_loaded = false;
+        std::mutex m_loadMutex;             // 로드끼리만 직렬화 (조회는 잠그지 않음)
+        std::atomic<bool> m_loaded{ false };
 
-        static const WeaponSpecification s_defaultWeaponSpec;
+        // 변경 통지 구독자 (통지 중에도 보유하여 해제와 통지가 겹치지 않음)
+        std::mutex m_listenerMutex;
+        std::map<int, ConfigChangeListener> m_listeners;
+        int m_nextSubscriptionId{ 0 };
     };
 } // namespace MINEASMALM
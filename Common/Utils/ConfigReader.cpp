@@ -13,6 +13,7 @@ namespace MINEASMALM {
 
         m_config.clear();
         m_sections.clear();
+        m_parseErrors.clear();
         std::string line;
         std::string currentSection;
 
@@ -70,13 +71,20 @@ namespace MINEASMALM {
             return defaultValue;
         }
 
+        // 값 전체가 숫자여야 함 (예: "5abc" 는 오류)
         try {
-            return std::stoi(value);
+            size_t parsed = 0;
+            int result = std::stoi(value, &parsed);
+            if (parsed == value.length()) {
+                return result;
+            }
         }
         catch (const std::exception&) {
-            std::cerr << "Invalid integer value for [" << section << "]." << key << ": " << value << std::endl;
-            return defaultValue;
         }
+
+        std::cerr << "Invalid integer value for [" << section << "]." << key << ": " << value << std::endl;
+        m_parseErrors.push_back("[" + section + "]." + key + ": " + value);
+        return defaultValue;
     }
 
     double ConfigReader::GetDouble(const std::string& section, const std::string& key, double defaultValue) const {
@@ -86,12 +94,18 @@ namespace MINEASMALM {
         }
 
         try {
-            return std::stod(value);
+            size_t parsed = 0;
+            double result = std::stod(value, &parsed);
+            if (parsed == value.length()) {
+                return result;
+            }
         }
         catch (const std::exception&) {
-            std::cerr << "Invalid double value for [" << section << "]." << key << ": " << value << std::endl;
-            return defaultValue;
         }
+
+        std::cerr << "Invalid double value for [" << section << "]." << key << ": " << value << std::endl;
+        m_parseErrors.push_back("[" + section + "]." + key + ": " + value);
+        return defaultValue;
     }
 
     bool ConfigReader::GetBool(const std::string& section, const std::string& key, bool defaultValue) const {
@@ -111,6 +125,7 @@ namespace MINEASMALM {
         }
 
         std::cerr << "Invalid boolean value for [" << section << "]." << key << ": " << value << std::endl;
+        m_parseErrors.push_back("[" + section + "]." + key + ": " + value);
         return defaultValue;
     }
 
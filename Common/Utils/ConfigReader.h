@@ -78,6 +78,12 @@ namespace MINEASMALM {
          */
         std::vector<std::string> GetKeysInSection(const std::string& section) const;
 
+        /**
+         * @brief 형식이 맞지 않아 기본값으로 대체된 항목 목록 ("[섹션].키: 값")
+         * @return 조회 중 발견된 형식 오류 (로드 검증용)
+         */
+        const std::vector<std::string>& GetParseErrors() const { return m_parseErrors; }
+
     private:
         /**
          * @brief 문자열 앞뒤 공백 제거
@@ -91,6 +97,7 @@ namespace MINEASMALM {
 
         std::map<std::string, std::string> m_config;  // section.key -> value 맵
         std::set<std::string> m_sections;  // 섹션 이름 목록
+        mutable std::vector<std::string> m_parseErrors;  // 형식 오류 (Get 호출 시 기록)
         bool m_loaded = false;
     };
 
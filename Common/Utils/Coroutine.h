@@ -0,0 +1,407 @@
+#pragma once
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "TimerService.h"
+#include "WorkStealingPool.h"
+
+namespace AIEP {
+
+    // =============================================================================
+    // 취소 요청 전달 (할당 변경, 종료 시 진행 중인 비동기 흐름 중단)
+    // =============================================================================
+
+    /**
+     * @brief 취소 여부 조회 및 취소 알림 등록 (CancellationSource 에서 발급, 복사 가능)
+     *
+     * 기본 생성된 토큰은 취소되지 않습니다.
+     */
+    class CancellationToken {
+    public:
+        CancellationToken() = default;
+
+        bool IsCancelled() const {
+            if (!m_state) {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            return m_state->cancelled;
+        }
+
+        /**
+         * @brief 취소 시 호출될 콜백 등록 (취소하는 스레드에서 호출)
+         * @return 등록 번호, 이미 취소되었거나 취소될 수 없는 토큰이면 0 (콜백 호출 안 함)
+         */
+        uint64_t Subscribe(std::function<void()> callback) const {
+            if (!m_state) {
+                return 0;
+            }
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            if (m_state->cancelled) {
+                return 0;
+            }
+            uint64_t id = m_state->nextId++;
+            m_state->callbacks.emplace(id, std::move(callback));
+            return id;
+        }
+
+        void Unsubscribe(uint64_t id) const {
+            if (!m_state || id == 0) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            m_state->callbacks.erase(id);
+        }
+
+    private:
+        friend class CancellationSource;
+
+        struct State {
+            std::mutex mutex;
+            bool cancelled{ false };
+            uint64_t nextId{ 1 };
+            std::map<uint64_t, std::function<void()>> callbacks;
+        };
+
+        explicit CancellationToken(std::shared_ptr<State> state) : m_state(std::move(state)) {}
+
+        std::shared_ptr<State> m_state;
+    };
+
+    class CancellationSource {
+    public:
+        CancellationSource() : m_state(std::make_shared<CancellationToken::State>()) {}
+
+        CancellationToken Token() const {
+            return CancellationToken(m_state);
+        }
+
+        /**
+         * @brief 취소 요청 (등록된 콜백은 잠금 해제 후 이 스레드에서 호출)
+         */
+        void Cancel() {
+            std::map<uint64_t, std::function<void()>> callbacks;
+            {
+                std::lock_guard<std::mutex> lock(m_state->mutex);
+                if (m_state->cancelled) {
+                    return;
+                }
+                m_state->cancelled = true;
+                callbacks.swap(m_state->callbacks);
+            }
+            for (auto& [id, callback] : callbacks) {
+                callback();
+            }
+        }
+
+    private:
+        std::shared_ptr<CancellationToken::State> m_state;
+    };
+
+    // =============================================================================
+    // 코루틴 작업 (co_await 로 순차 연결, 대기 중에는 스레드를 점유하지 않음)
+    // =============================================================================
+
+    template <typename T>
+    class Task;
+
+    namespace detail {
+
+        struct TaskPromiseBase {
+            std::coroutine_handle<> continuation;
+            std::exception_ptr error;
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+
+            // 완료 시 기다리던 코루틴으로 바로 전환 (재귀 호출 없음)
+            struct FinalAwaiter {
+                bool await_ready() noexcept { return false; }
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+                    auto continuation = handle.promise().continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+                void await_resume() noexcept {}
+            };
+            FinalAwaiter final_suspend() noexcept { return {}; }
+
+            void unhandled_exception() { error = std::current_exception(); }
+        };
+
+        template <typename T>
+        struct TaskPromise : TaskPromiseBase {
+            std::optional<T> value;
+
+            Task<T> get_return_object();
+            void return_value(T result) { value = std::move(result); }
+            T Result() {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+                return std::move(*value);
+            }
+        };
+
+        template <>
+        struct TaskPromise<void> : TaskPromiseBase {
+            Task<void> get_return_object();
+            void return_void() {}
+            void Result() {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        };
+
+        // 분리 실행용 (시작 즉시 실행, 완료 시 스스로 해제)
+        struct DetachedTask {
+            struct promise_type {
+                DetachedTask get_return_object() { return {}; }
+                std::suspend_never initial_suspend() noexcept { return {}; }
+                std::suspend_never final_suspend() noexcept { return {}; }
+                void return_void() {}
+                void unhandled_exception() { std::terminate(); }
+            };
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief 지연 시작 코루틴 작업 (co_await 할 때 시작, 결과 또는 예외를 호출한 코루틴에 전달)
+     *
+     * 최상위 흐름은 StartDetached() 로 시작합니다.
+     */
+    template <typename T = void>
+    class Task {
+    public:
+        using promise_type = detail::TaskPromise<T>;
+
+        Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                if (m_handle) {
+                    m_handle.destroy();
+                }
+                m_handle = std::exchange(other.m_handle, {});
+            }
+            return *this;
+        }
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task() {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+        }
+
+        bool await_ready() const noexcept { return false; }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            m_handle.promise().continuation = awaiting;
+            return m_handle;
+        }
+        T await_resume() { return m_handle.promise().Result(); }
+
+    private:
+        friend struct detail::TaskPromise<T>;
+        explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+    namespace detail {
+
+        template <typename T>
+        Task<T> TaskPromise<T>::get_return_object() {
+            return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+        }
+
+        inline Task<void> TaskPromise<void>::get_return_object() {
+            return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+        }
+
+        inline DetachedTask RunDetached(Task<void> task, std::function<void(std::exception_ptr)> onComplete) {
+            std::exception_ptr error;
+            try {
+                co_await task;
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            if (onComplete) {
+                onComplete(error);
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief 최상위 흐름 시작 (첫 대기 지점까지 호출 스레드에서 실행)
+     * @param onComplete 완료 시 호출 (예외로 끝났으면 그 예외, 정상 종료면 nullptr)
+     */
+    inline void StartDetached(Task<void> task, std::function<void(std::exception_ptr)> onComplete = nullptr) {
+        detail::RunDetached(std::move(task), std::move(onComplete));
+    }
+
+    // =============================================================================
+    // 대기 지점
+    // =============================================================================
+
+    /**
+     * @brief 이후 단계를 공용 작업 풀에서 계속 (DDS 수신/타이머 스레드에서 무거운 단계를 분리)
+     *
+     * 풀이 정지 상태이면 현재 스레드에서 계속합니다.
+     */
+    struct ResumeOnPool {
+        WorkStealingPool::Clock::time_point deadline;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle) const {
+            return WorkStealingPool::GetInstance().Submit([handle]() { handle.resume(); }, deadline);
+        }
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * @brief 단일 대기자 메시지 수신함 (요청-응답 흐름에서 응답 대기)
+     *
+     * Wait() 호출 시점에 대기자로 등록되므로 요청 송신 전에 Wait() 를 만들어 두면 빠른 응답도 놓치지 않습니다.
+     * 값 전달, 시간 초과, 취소 중 먼저 일어난 하나로 대기가 끝나며 이후 단계는 공용 작업 풀에서 재개됩니다.
+     * 새 대기자가 등록되면 이전 대기자는 값 없이 끝납니다.
+     */
+    template <typename T>
+    class AsyncSlot {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        class Awaiter;
+
+        /**
+         * @brief 다음 값 대기 (co_await 결과: 값, 시간 초과/취소/대체 시 std::nullopt)
+         */
+        Awaiter Wait(Clock::duration timeout, CancellationToken token) {
+            auto state = std::make_shared<WaitState>();
+            std::shared_ptr<WaitState> replaced;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                replaced = std::exchange(m_waiter, state);
+            }
+            if (replaced) {
+                Complete(replaced, std::nullopt);
+            }
+            return Awaiter(this, std::move(state), timeout, std::move(token));
+        }
+
+        /**
+         * @brief 대기 중인 흐름에 값 전달 (대기자가 없으면 false, 값은 버림)
+         */
+        bool Deliver(const T& value) {
+            std::shared_ptr<WaitState> waiter;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                waiter = std::exchange(m_waiter, nullptr);
+            }
+            return waiter && Complete(waiter, value);
+        }
+
+    private:
+        struct WaitState {
+            std::mutex mutex;
+            std::coroutine_handle<> handle;
+            std::optional<T> value;
+            bool done{ false };
+            int timerId{ -1 };
+            uint64_t cancelId{ 0 };
+        };
+
+        // 먼저 도착한 결과만 반영, 이미 대기 중이면 공용 작업 풀에서 재개
+        static bool Complete(const std::shared_ptr<WaitState>& state, std::optional<T> value) {
+            std::coroutine_handle<> handle;
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->done) {
+                    return false;
+                }
+                state->done = true;
+                state->value = std::move(value);
+                handle = state->handle;
+            }
+            if (handle && !WorkStealingPool::GetInstance().Submit([handle]() { handle.resume(); }, Clock::now())) {
+                handle.resume();
+            }
+            return true;
+        }
+
+        void Release(const std::shared_ptr<WaitState>& state) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_waiter == state) {
+                m_waiter.reset();
+            }
+        }
+
+        std::mutex m_mutex;
+        std::shared_ptr<WaitState> m_waiter;
+
+    public:
+        class Awaiter {
+        public:
+            bool await_ready() const noexcept { return false; }
+
+            bool await_suspend(std::coroutine_handle<> handle) {
+                auto state = m_state;     // 잠금 해제 직후 다른 스레드에서 재개되어도 유지
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->done) {
+                    return false;           // 대기 전에 값이 도착했거나 대체됨
+                }
+
+                state->cancelId = m_token.Subscribe([state]() { Complete(state, std::nullopt); });
+                if (state->cancelId == 0 && m_token.IsCancelled()) {
+                    state->done = true;
+                    return false;
+                }
+
+                state->timerId = TimerService::GetInstance().ScheduleOnce(Clock::now() + m_timeout,
+                    [state](Clock::time_point) { Complete(state, std::nullopt); });
+                state->handle = handle;
+                return true;
+            }
+
+            std::optional<T> await_resume() {
+                int timerId;
+                uint64_t cancelId;
+                std::optional<T> value;
+                {
+                    std::lock_guard<std::mutex> lock(m_state->mutex);
+                    timerId = std::exchange(m_state->timerId, -1);
+                    cancelId = std::exchange(m_state->cancelId, 0);
+                    value = std::move(m_state->value);
+                }
+                if (timerId >= 0) {
+                    TimerService::GetInstance().Cancel(timerId);
+                }
+                m_token.Unsubscribe(cancelId);
+                m_slot->Release(m_state);
+                return value;
+            }
+
+        private:
+            friend class AsyncSlot;
+            Awaiter(AsyncSlot* slot, std::shared_ptr<WaitState> state, Clock::duration timeout, CancellationToken token)
+                : m_slot(slot), m_state(std::move(state)), m_timeout(timeout), m_token(std::move(token)) {}
+
+            AsyncSlot* m_slot;
+            std::shared_ptr<WaitState> m_state;
+            Clock::duration m_timeout;
+            CancellationToken m_token;
+        };
+    };
+
+} // namespace AIEP
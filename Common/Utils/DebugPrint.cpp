@@ -5,4 +5,5 @@ std::ofstream DebugLogger::logFile;
 std::mutex DebugLogger::logMutex;
 bool DebugLogger::initialized = false;
 int DebugLogger::tubeNumber = 0;
+std::atomic<int> DebugLogger::minimumLevel{ DebugLogger::LEVEL_DEBUG };
 
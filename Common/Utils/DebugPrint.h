@@ -1,5 +1,6 @@
 // Common/Utils/DebugPrint.h
 #pragma once
+#include <atomic>
 #include <iostream>
 #include <fstream>
 #include <iomanip>
@@ -26,6 +27,10 @@
 #define ENABLE_DDSCOMM_DEBUG                 1
 #define ENABLE_MINEMANAGER_DEBUG             1
 #define ENABLE_CONFIGMANAGER_DEBUG           1
+#define ENABLE_FILEWATCHER_DEBUG             1
+#define ENABLE_TIMERSERVICE_DEBUG            1
+#define ENABLE_REALTIME_DEBUG                1
+#define ENABLE_WORKPOOL_DEBUG                1
 #else
 #define ENABLE_MAIN_DEBUG                    0
 #define ENABLE_LAUNCHTUBEMANAGER_DEBUG       0
@@ -36,6 +41,10 @@
 #define ENABLE_DDSCOMM_DEBUG                 0
 #define ENABLE_MINEMANAGER_DEBUG             0
 #define ENABLE_CONFIGMANAGER_DEBUG           0
+#define ENABLE_FILEWATCHER_DEBUG             0
+#define ENABLE_TIMERSERVICE_DEBUG            0
+#define ENABLE_REALTIME_DEBUG                0
+#define ENABLE_WORKPOOL_DEBUG                0
 #endif
 
 class DebugLogger {
@@ -44,8 +53,11 @@ private:
     static std::mutex logMutex;
     static bool initialized;
     static int tubeNumber;  // 발사관 번호 저장
+    static std::atomic<int> minimumLevel;  // 실행 중 출력 수준 (설정 변경 시 갱신)
 
 public:
+    enum Level { LEVEL_DEBUG = 0, LEVEL_WARNING = 1, LEVEL_ERROR = 2 };
+
     // 발사관 번호를 포함한 초기화 함수
     static void Initialize(int tubeNum, const std::string& customLogFileName = "") {
         std::lock_guard<std::mutex> lock(logMutex);
@@ -127,6 +139,18 @@ public:
     }
 
     static int GetTubeNumber() { return tubeNumber; }
+
+    // 출력 수준 변경 ("DEBUG", "WARNING", "ERROR", 모듈별 컴파일 시 설정은 그대로 적용)
+    static void SetMinimumLevel(const std::string& levelName) {
+        int level = LEVEL_DEBUG;
+        if (levelName == "WARNING") level = LEVEL_WARNING;
+        else if (levelName == "ERROR") level = LEVEL_ERROR;
+        minimumLevel.store(level, std::memory_order_relaxed);
+    }
+
+    static bool IsLevelEnabled(int level) {
+        return level >= minimumLevel.load(std::memory_order_relaxed);
+    }
 };
 
 // 콘솔 + 파일 동시 출력을 위한 커스텀 스트림 클래스 (기존과 동일)
@@ -191,15 +215,15 @@ public:
     }
 };
 
-// 기존 매크로 (변경 없음)
+// 기존 매크로 (모듈별 컴파일 시 설정 + 실행 중 출력 수준)
 #define DEBUG_STREAM(module) \
-    if (ENABLE_##module##_DEBUG) \
+    if (ENABLE_##module##_DEBUG && DebugLogger::IsLevelEnabled(DebugLogger::LEVEL_DEBUG)) \
         DualOutputStream(#module, "DEBUG")
 
 #define DEBUG_ERROR_STREAM(module) \
-    if (ENABLE_##module##_DEBUG) \
+    if (ENABLE_##module##_DEBUG && DebugLogger::IsLevelEnabled(DebugLogger::LEVEL_ERROR)) \
         DualOutputStream(#module, "ERROR")
 
 #define DEBUG_WARNING_STREAM(module) \
-    if (ENABLE_##module##_DEBUG) \
+    if (ENABLE_##module##_DEBUG && DebugLogger::IsLevelEnabled(DebugLogger::LEVEL_WARNING)) \
         DualOutputStream(#module, "WARNING")
@@ -0,0 +1,176 @@
+#include "FileWatcher.h"
+#include "DebugPrint.h"
+#include "RealTimeProfile.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <filesystem>
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace AIEP {
+
+    FileWatcher& FileWatcher::GetInstance() {
+        static FileWatcher instance;
+        return instance;
+    }
+
+    FileWatcher::~FileWatcher() {
+        Stop();
+    }
+
+    bool FileWatcher::OpenDescriptors() {
+        if (m_inotifyFd >= 0) {
+            return true;
+        }
+
+        m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_inotifyFd < 0) {
+            DEBUG_ERROR_STREAM(FILEWATCHER) << "inotify_init1 failed" << std::endl;
+            return false;
+        }
+
+        m_stopEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_stopEventFd < 0) {
+            DEBUG_ERROR_STREAM(FILEWATCHER) << "eventfd creation failed" << std::endl;
+            close(m_inotifyFd);
+            m_inotifyFd = -1;
+            return false;
+        }
+        return true;
+    }
+
+    bool FileWatcher::Watch(const std::string& path, ChangeCallback callback) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!OpenDescriptors()) {
+            return false;
+        }
+
+        std::filesystem::path filePath = std::filesystem::absolute(path);
+        std::string dir = filePath.parent_path().string();
+
+        int wd = inotify_add_watch(m_inotifyFd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+        if (wd < 0) {
+            DEBUG_ERROR_STREAM(FILEWATCHER) << "Failed to watch directory: " << dir << std::endl;
+            return false;
+        }
+
+        m_watchDirs[wd] = dir;
+        m_entries[wd].push_back({ path, filePath.filename().string(), std::move(callback) });
+
+        DEBUG_STREAM(FILEWATCHER) << "Watching file for changes: " << path << std::endl;
+        return true;
+    }
+
+    bool FileWatcher::Start() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!OpenDescriptors()) {
+                return false;
+            }
+        }
+
+        if (m_running.exchange(true)) {
+            return true;
+        }
+
+        m_watchThread = std::thread([this]() { WatchLoop(); });
+        return true;
+    }
+
+    void FileWatcher::Stop() {
+        if (!m_running.exchange(false)) {
+            return;
+        }
+
+        uint64_t one = 1;
+        if (write(m_stopEventFd, &one, sizeof(one)) < 0) {
+            DEBUG_ERROR_STREAM(FILEWATCHER) << "Failed to signal file watcher stop" << std::endl;
+        }
+
+        if (m_watchThread.joinable()) {
+            m_watchThread.join();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& dir : m_watchDirs) {
+            inotify_rm_watch(m_inotifyFd, dir.first);
+        }
+        m_watchDirs.clear();
+        m_entries.clear();
+
+        close(m_inotifyFd);
+        close(m_stopEventFd);
+        m_inotifyFd = -1;
+        m_stopEventFd = -1;
+    }
+
+    void FileWatcher::WatchLoop() {
+        alignas(struct inotify_event) char buffer[4096];
+        struct pollfd fds[2] = {
+            { m_inotifyFd, POLLIN, 0 },
+            { m_stopEventFd, POLLIN, 0 }
+        };
+
+        RealTimeProfile::ApplyCurrentThread("FileWatcher");
+
+        while (m_running.load()) {
+            int ready = poll(fds, 2, -1); // 이벤트가 올 때까지 대기 (주기적 깨어남 없음)
+            if (ready < 0) {
+                if (errno == EINTR) continue;
+                DEBUG_ERROR_STREAM(FILEWATCHER) << "File watcher poll failed" << std::endl;
+                break;
+            }
+
+            if (fds[1].revents & POLLIN) {
+                break;
+            }
+
+            if (fds[0].revents & POLLIN) {
+                long length = read(m_inotifyFd, buffer, sizeof(buffer));
+                if (length > 0) {
+                    DispatchEvents(buffer, length);
+                }
+            }
+        }
+    }
+
+    void FileWatcher::DispatchEvents(const char* buffer, long length) {
+        // 한 번의 read에 같은 파일의 이벤트가 여러 개 올 수 있으므로 파일당 한 번만 통지
+        std::vector<WatchEntry> changed;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const char* ptr = buffer; ptr < buffer + length; ) {
+                const auto* event = reinterpret_cast<const struct inotify_event*>(ptr);
+                ptr += sizeof(struct inotify_event) + event->len;
+
+                if (event->len == 0) continue;
+
+                auto it = m_entries.find(event->wd);
+                if (it == m_entries.end()) continue;
+
+                for (const auto& entry : it->second) {
+                    bool alreadyQueued = std::any_of(changed.begin(), changed.end(),
+                        [&entry](const WatchEntry& queued) { return queued.path == entry.path; });
+                    if (entry.fileName == event->name && !alreadyQueued) {
+                        changed.push_back(entry);
+                    }
+                }
+            }
+        }
+
+        // 콜백은 잠금 해제 후 호출 (콜백 내에서 Watch 호출 가능)
+        for (const auto& entry : changed) {
+            try {
+                entry.callback(entry.path);
+            }
+            catch (const std::exception& e) {
+                DEBUG_ERROR_STREAM(FILEWATCHER) << "File change handler failed for " << entry.path << ": " << e.what() << std::endl;
+            }
+        }
+    }
+
+} // namespace AIEP
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <functional>
+
+namespace AIEP {
+
+    /**
+     * @brief inotify 기반 파일 변경 감시자 (Linux)
+     *
+     * 파일이 위치한 디렉토리를 감시하므로 직접 기록(IN_CLOSE_WRITE)과
+     * 임시 파일 교체(IN_MOVED_TO) 방식의 저장을 모두 감지합니다.
+     * 변경이 없으면 감시 스레드는 poll()에서 대기하며 디스크를 주기적으로 확인하지 않습니다.
+     */
+    class FileWatcher {
+    public:
+        using ChangeCallback = std::function<void(const std::string& path)>;
+
+        static FileWatcher& GetInstance();
+
+        /**
+         * @brief 감시 대상 파일 등록 (Start 전후 모두 가능)
+         * @param path 감시할 파일 경로
+         * @param callback 파일 변경 시 감시 스레드에서 호출되는 콜백
+         * @return 성공 여부
+         */
+        bool Watch(const std::string& path, ChangeCallback callback);
+
+        /**
+         * @brief 감시 스레드 시작/정지
+         */
+        bool Start();
+        void Stop();
+
+    private:
+        FileWatcher() = default;
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        bool OpenDescriptors();
+        void WatchLoop();
+        void DispatchEvents(const char* buffer, long length);
+
+        struct WatchEntry {
+            std::string path;
+            std::string fileName;
+            ChangeCallback callback;
+        };
+
+        int m_inotifyFd{ -1 };
+        int m_stopEventFd{ -1 };                        // Stop() 시 poll() 즉시 해제용
+        std::map<int, std::string> m_watchDirs;         // watch descriptor -> 디렉토리
+        std::map<int, std::vector<WatchEntry>> m_entries; // watch descriptor -> 감시 파일
+
+        std::thread m_watchThread;
+        std::atomic<bool> m_running{ false };
+        std::mutex m_mutex;
+    };
+
+} // namespace AIEP
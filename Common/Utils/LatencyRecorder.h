@@ -0,0 +1,66 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace AIEP {
+
+    /**
+     * @brief 최근 N개 지연 시간 표본의 백분위 산출기
+     *
+     * 표본은 고정 크기 링 버퍼에 마이크로초 단위로 저장되어 기록 시 메모리 할당이 없습니다.
+     * 백분위는 GetSummary() 호출 시점의 표본 복사본으로 계산합니다.
+     */
+    template <size_t SampleCount = 256>
+    class LatencyRecorder {
+    public:
+        struct Summary {
+            uint64_t count{ 0 };        // 누적 기록 수
+            uint32_t p50_us{ 0 };
+            uint32_t p90_us{ 0 };
+            uint32_t p99_us{ 0 };
+            uint32_t max_us{ 0 };
+        };
+
+        void Record(std::chrono::steady_clock::duration latency) {
+            auto us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+            uint32_t sample = static_cast<uint32_t>(std::clamp<int64_t>(us, 0, UINT32_MAX));
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_samples[m_totalCount % SampleCount] = sample;
+            ++m_totalCount;
+        }
+
+        Summary GetSummary() const {
+            std::array<uint32_t, SampleCount> sorted;
+            Summary summary;
+            size_t n;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                summary.count = m_totalCount;
+                n = static_cast<size_t>(std::min<uint64_t>(m_totalCount, SampleCount));
+                std::copy_n(m_samples.begin(), n, sorted.begin());
+            }
+            if (n == 0) {
+                return summary;
+            }
+
+            std::sort(sorted.begin(), sorted.begin() + n);
+            auto at = [&](double ratio) { return sorted[std::min(n - 1, static_cast<size_t>(ratio * n))]; };
+            summary.p50_us = at(0.50);
+            summary.p90_us = at(0.90);
+            summary.p99_us = at(0.99);
+            summary.max_us = sorted[n - 1];
+            return summary;
+        }
+
+    private:
+        std::array<uint32_t, SampleCount> m_samples{};
+        uint64_t m_totalCount{ 0 };
+        mutable std::mutex m_mutex;
+    };
+
+} // namespace AIEP
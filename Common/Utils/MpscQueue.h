@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace AIEP {
+
+    /**
+     * @brief 고정 크기 lock-free 다중 생산자 / 단일 소비자 큐
+     *
+     * 슬롯마다 순번(sequence)을 두는 링 버퍼 방식으로, 생산자는 CAS 한 번으로 슬롯을 확보하고
+     * 소비자는 원자적 연산 없이 꺼냅니다. 큐가 가득 차면 TryPush는 즉시 false를 반환합니다.
+     * 소비자 깨우기(eventfd 등)는 사용하는 쪽에서 처리합니다.
+     *
+     * @tparam T 원소 타입 (복사/이동 대입 가능)
+     * @tparam Capacity 슬롯 수 (2의 거듭제곱)
+     */
+    template <typename T, size_t Capacity>
+    class BoundedMpscQueue {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        BoundedMpscQueue() {
+            for (size_t i = 0; i < Capacity; ++i) {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+        BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+
+        /**
+         * @brief 원소 추가 (여러 스레드에서 동시 호출 가능)
+         * @return 큐가 가득 찬 경우 false
+         */
+        bool TryPush(const T& value) {
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+            Cell* cell;
+            for (;;) {
+                cell = &m_cells[pos & (Capacity - 1)];
+                size_t seq = cell->sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                if (diff == 0) {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                }
+                else if (diff < 0) {
+                    return false; // 가득 참
+                }
+                else {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->value = value;
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief 원소 꺼내기 (소비자 스레드 하나에서만 호출)
+         * @return 큐가 빈 경우 false
+         */
+        bool TryPop(T& out) {
+            Cell* cell = &m_cells[m_dequeuePos & (Capacity - 1)];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(m_dequeuePos + 1) < 0) {
+                return false;
+            }
+
+            out = std::move(cell->value);
+            cell->sequence.store(m_dequeuePos + Capacity, std::memory_order_release);
+            ++m_dequeuePos;
+            return true;
+        }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            T value{};
+        };
+
+        std::array<Cell, Capacity> m_cells;
+        alignas(64) std::atomic<size_t> m_enqueuePos{ 0 };
+        alignas(64) size_t m_dequeuePos{ 0 };           // 소비자 전용
+    };
+
+} // namespace AIEP
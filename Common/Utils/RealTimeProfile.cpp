@@ -0,0 +1,95 @@
+#include "RealTimeProfile.h"
+#include "ConfigManager.h"
+#include "DebugPrint.h"
+
+#include <algorithm>
+#include <alloca.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+namespace AIEP {
+
+    bool RealTimeProfile::ApplyProcessProfile() {
+        auto config = ConfigManager::GetInstance().GetSnapshot();
+        const auto& realTime = config->realTime;
+        if (!realTime.lockMemory) {
+            return true;
+        }
+
+        // 이후 할당되는 페이지까지 고정하여 실행 중 페이지 폴트 방지
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+            DEBUG_WARNING_STREAM(REALTIME) << "mlockall failed (check RLIMIT_MEMLOCK)" << std::endl;
+            return false;
+        }
+
+        DEBUG_STREAM(REALTIME) << "Process memory locked" << std::endl;
+        return true;
+    }
+
+    void RealTimeProfile::ApplyCurrentThread(const std::string& role) {
+        auto config = ConfigManager::GetInstance().GetSnapshot();
+        const auto& realTime = config->realTime;
+
+        pthread_setname_np(pthread_self(), role.substr(0, 15).c_str()); // 지터 분석 시 스레드 식별용
+
+        if (realTime.prefaultStack_kb > 0) {
+            PrefaultStack(static_cast<size_t>(realTime.prefaultStack_kb) * 1024);
+        }
+
+        auto it = realTime.threadRoles.find(role);
+        if (it == realTime.threadRoles.end()) {
+            return;
+        }
+        const ThreadRoleConfig& roleConfig = it->second;
+
+        // CPU 고정
+        if (!roleConfig.cpus.empty()) {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            for (int cpu : roleConfig.cpus) {
+                if (cpu >= 0 && cpu < CPU_SETSIZE) {
+                    CPU_SET(cpu, &cpuSet);
+                }
+            }
+            if (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) != 0) {
+                DEBUG_WARNING_STREAM(REALTIME) << "CPU affinity failed for thread role " << role << std::endl;
+            }
+        }
+
+        // 스케줄링 정책/우선순위
+        int policy = SCHED_OTHER;
+        if (roleConfig.policy == "FIFO") {
+            policy = SCHED_FIFO;
+        }
+        else if (roleConfig.policy == "RR") {
+            policy = SCHED_RR;
+        }
+        else if (roleConfig.policy != "OTHER") {
+            DEBUG_WARNING_STREAM(REALTIME) << "Unknown scheduling policy for " << role << ": " << roleConfig.policy << std::endl;
+        }
+
+        sched_param param{};
+        if (policy != SCHED_OTHER) {
+            param.sched_priority = std::clamp(roleConfig.priority, sched_get_priority_min(policy), sched_get_priority_max(policy));
+        }
+        if (pthread_setschedparam(pthread_self(), policy, &param) != 0) {
+            DEBUG_WARNING_STREAM(REALTIME) << "Scheduling policy failed for thread role " << role << " (check CAP_SYS_NICE)" << std::endl;
+            return;
+        }
+
+        DEBUG_STREAM(REALTIME) << "Thread role " << role << " - policy: " << roleConfig.policy
+            << ", priority: " << param.sched_priority << ", CPUs: " << roleConfig.cpus.size() << std::endl;
+    }
+
+    __attribute__((noinline)) void RealTimeProfile::PrefaultStack(size_t bytes) {
+        // 기본 스레드 스택(8 MB)을 넘지 않도록 제한
+        bytes = std::min<size_t>(bytes, 4 * 1024 * 1024);
+
+        volatile char* stack = static_cast<volatile char*>(alloca(bytes));
+        for (size_t offset = 0; offset < bytes; offset += 4096) {
+            stack[offset] = 0;
+        }
+    }
+
+} // namespace AIEP
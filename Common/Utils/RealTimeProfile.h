@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+
+namespace AIEP {
+
+    /**
+     * @brief config.ini [RealTime] 섹션 기반 실시간 실행 설정 적용 (Linux)
+     *
+     * 역할 이름(Main, Timer, Engagement, WeaponControl, FileWatcher)별로 스케줄링 정책/우선순위와
+     * CPU 고정을 적용합니다. 설정이 없는 역할은 기본 스케줄링 그대로 동작합니다.
+     * 권한 부족(CAP_SYS_NICE, RLIMIT_MEMLOCK) 시 경고만 남기고 계속 진행합니다.
+     */
+    class RealTimeProfile {
+    public:
+        /**
+         * @brief 프로세스 전체 설정 적용 (LockMemory 시 mlockall), main에서 설정 로드 직후 1회 호출
+         */
+        static bool ApplyProcessProfile();
+
+        /**
+         * @brief 호출한 스레드에 역할별 설정 적용 (스레드 시작 직후 호출)
+         * @param role [RealTime] 섹션의 역할 이름
+         */
+        static void ApplyCurrentThread(const std::string& role);
+
+    private:
+        static void PrefaultStack(size_t bytes);
+    };
+
+} // namespace AIEP
@@ -0,0 +1,193 @@
+#include "ShutdownController.h"
+#include "DebugPrint.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <ctime>
+#include <sstream>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AIEP {
+
+    namespace {
+        // 신호 처리기에서 사용하는 값 (async-signal-safe 함수와 lock-free 원자 변수만 사용)
+        int g_shutdownEventFd = -1;
+        std::atomic<int64_t> g_requestTime_ns{ 0 };    // 최초 종료 요청 시각 (CLOCK_MONOTONIC)
+        std::atomic<int> g_signalCount{ 0 };
+        static_assert(std::atomic<int64_t>::is_always_lock_free, "signal handler requires lock-free atomics");
+
+        int64_t MonotonicNow_ns() {
+            struct timespec now {};
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            return static_cast<int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+        }
+
+        void WakeShutdownWaiter() {
+            uint64_t one = 1;
+            ssize_t written = write(g_shutdownEventFd, &one, sizeof(one));
+            (void)written;
+        }
+
+        sigset_t ShutdownSignals() {
+            sigset_t signals;
+            sigemptyset(&signals);
+            sigaddset(&signals, SIGINT);
+            sigaddset(&signals, SIGTERM);
+            return signals;
+        }
+    }
+
+    ShutdownController& ShutdownController::GetInstance() {
+        static ShutdownController instance;
+        return instance;
+    }
+
+    ShutdownController::~ShutdownController() {
+        CompleteShutdown();
+    }
+
+    bool ShutdownController::InstallSignalHandlers() {
+        if (g_shutdownEventFd < 0) {
+            g_shutdownEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (g_shutdownEventFd < 0) {
+                DEBUG_ERROR_STREAM(MAIN) << "Shutdown eventfd creation failed" << std::endl;
+                return false;
+            }
+        }
+
+        // 이후 생성되는 스레드는 신호를 받지 않음 (poll() 이 EINTR 로 깨어나지 않도록)
+        sigset_t signals = ShutdownSignals();
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+        struct sigaction action {};
+        action.sa_handler = &ShutdownController::OnSignal;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_RESTART;
+        if (sigaction(SIGINT, &action, nullptr) < 0 || sigaction(SIGTERM, &action, nullptr) < 0) {
+            DEBUG_ERROR_STREAM(MAIN) << "Signal handler installation failed" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    void ShutdownController::OnSignal(int /*signalNumber*/) {
+        // 두 번째 신호는 종료 절차를 기다리지 않고 즉시 종료
+        if (g_signalCount.fetch_add(1) > 0) {
+            _exit(EXIT_FAILURE);
+        }
+        int64_t expected = 0;
+        g_requestTime_ns.compare_exchange_strong(expected, MonotonicNow_ns());
+        WakeShutdownWaiter();
+    }
+
+    void ShutdownController::MarkRequested() {
+        int64_t expected = 0;
+        g_requestTime_ns.compare_exchange_strong(expected, MonotonicNow_ns());
+        m_shutdownRequested.store(true);
+    }
+
+    void ShutdownController::RequestShutdown() {
+        MarkRequested();
+        if (g_shutdownEventFd >= 0) {
+            WakeShutdownWaiter();
+        }
+    }
+
+    void ShutdownController::WaitForShutdownRequest() {
+        if (g_shutdownEventFd < 0) {
+            return;
+        }
+
+        // 이 스레드에서만 종료 신호 수신
+        sigset_t signals = ShutdownSignals();
+        pthread_sigmask(SIG_UNBLOCK, &signals, nullptr);
+
+        struct pollfd fd = { g_shutdownEventFd, POLLIN, 0 };
+        while (true) {
+            int ready = poll(&fd, 1, -1);
+            if (ready < 0 && errno == EINTR) {
+                continue;   // 신호 처리기가 eventfd 에 기록했으면 다음 poll 에서 바로 반환
+            }
+            break;
+        }
+
+        uint64_t count;
+        (void)read(g_shutdownEventFd, &count, sizeof(count));
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+        MarkRequested();
+    }
+
+    void ShutdownController::BeginShutdown(std::chrono::milliseconds deadline) {
+        MarkRequested();
+
+        // 진행 중인 산출/흐름 중단 요청 (콜백은 이 스레드에서 호출)
+        m_cancellation.Cancel();
+
+        std::lock_guard<std::mutex> lock(m_watchdogMutex);
+        if (m_watchdogThread.joinable() || deadline <= std::chrono::milliseconds::zero()) {
+            return;
+        }
+
+        auto expiry = Clock::time_point(std::chrono::nanoseconds(g_requestTime_ns.load())) + deadline;
+        m_watchdogThread = std::thread([this, expiry, deadline]() {
+            std::unique_lock<std::mutex> lock(m_watchdogMutex);
+            if (!m_watchdogCondition.wait_until(lock, expiry, [this]() { return m_completed; })) {
+                const char* lastStage = "none";
+                {
+                    std::lock_guard<std::mutex> stageLock(m_stageMutex);
+                    if (!m_stages.empty()) {
+                        lastStage = m_stages.back().first;
+                    }
+                }
+                DEBUG_ERROR_STREAM(MAIN) << "Shutdown exceeded " << deadline.count() << " ms after stage '" << lastStage
+                    << "' - forcing exit" << std::endl;
+                _exit(EXIT_FAILURE);
+            }
+            });
+    }
+
+    void ShutdownController::RecordStage(const char* stage) {
+        int64_t requested_ns = g_requestTime_ns.load();
+        auto elapsed = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::nanoseconds(requested_ns == 0 ? 0 : MonotonicNow_ns() - requested_ns));
+
+        std::lock_guard<std::mutex> lock(m_stageMutex);
+        m_stages.emplace_back(stage, elapsed);
+    }
+
+    std::string ShutdownController::BuildStageReport() const {
+        std::lock_guard<std::mutex> lock(m_stageMutex);
+
+        std::ostringstream report;
+        Clock::duration previous = Clock::duration::zero();
+        for (const auto& [stage, elapsed] : m_stages) {
+            report << stage << ": " << std::chrono::duration<double, std::milli>(elapsed).count() << " ms (+"
+                << std::chrono::duration<double, std::milli>(elapsed - previous).count() << " ms)\n";
+            previous = elapsed;
+        }
+        return report.str();
+    }
+
+    ShutdownController::Clock::duration ShutdownController::CompleteShutdown() {
+        {
+            std::lock_guard<std::mutex> lock(m_watchdogMutex);
+            m_completed = true;
+        }
+        m_watchdogCondition.notify_all();
+        if (m_watchdogThread.joinable()) {
+            m_watchdogThread.join();
+        }
+
+        int64_t requested_ns = g_requestTime_ns.load();
+        if (requested_ns == 0) {
+            return Clock::duration::zero();
+        }
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(MonotonicNow_ns() - requested_ns));
+    }
+
+} // namespace AIEP
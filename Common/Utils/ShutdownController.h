@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Coroutine.h"
+
+namespace AIEP {
+
+    /**
+     * @brief 프로세스 종료 요청 및 종료 시간 제한 관리
+     *
+     * SIGINT/SIGTERM 처리기는 eventfd 에 기록만 하고, 대기 중인 main 스레드가 깨어나 종료 절차를 진행합니다.
+     * 신호는 main 스레드에서만 받도록 다른 스레드 생성 전에 InstallSignalHandlers() 를 호출해야 합니다.
+     * 종료가 시작되면 공용 취소 토큰이 취소되어 각 루프/흐름이 진행 중인 작업을 중단하고,
+     * 제한 시간 내에 CompleteShutdown() 이 호출되지 않으면 프로세스를 강제 종료합니다.
+     */
+    class ShutdownController {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static ShutdownController& GetInstance();
+
+        /**
+         * @brief 종료 신호 처리기 설치 (호출 스레드와 이후 생성되는 스레드에서 신호 차단)
+         */
+        bool InstallSignalHandlers();
+
+        /**
+         * @brief 신호 없이 종료 요청 (어느 스레드에서나 호출 가능)
+         */
+        void RequestShutdown();
+
+        /**
+         * @brief 종료 요청까지 대기 (이 스레드에서만 신호 수신, 주기적 깨어남 없음)
+         */
+        void WaitForShutdownRequest();
+
+        /**
+         * @brief 종료 절차 시작 (공용 취소 토큰 취소, 제한 시간 감시 시작)
+         * @param deadline 종료 제한 시간, 초과 시 _exit
+         */
+        void BeginShutdown(std::chrono::milliseconds deadline);
+
+        /**
+         * @brief 종료 절차 완료 (감시 해제)
+         * @return 종료 요청 시각부터 경과 시간
+         */
+        Clock::duration CompleteShutdown();
+
+        /**
+         * @brief 종료 단계 완료 기록 (종료 요청 시각부터 경과 시간, 제한 시간 초과 시 마지막 완료 단계를 함께 기록)
+         * @param stage 단계 이름 (정적 문자열)
+         */
+        void RecordStage(const char* stage);
+
+        /**
+         * @brief 단계별 종료 소요 시간 보고 (단계 이름, 요청 시각부터 경과 ms, 직전 단계부터 ms)
+         */
+        std::string BuildStageReport() const;
+
+        bool IsShutdownRequested() const { return m_shutdownRequested.load(); }
+
+        /**
+         * @brief 종료 시 취소되는 공용 토큰 (교전계획 산출, 비동기 흐름 등에서 공유)
+         */
+        CancellationToken Token() const { return m_cancellation.Token(); }
+
+    private:
+        ShutdownController() = default;
+        ~ShutdownController();
+
+        ShutdownController(const ShutdownController&) = delete;
+        ShutdownController& operator=(const ShutdownController&) = delete;
+
+        static void OnSignal(int signalNumber);
+        void MarkRequested();
+
+        CancellationSource m_cancellation;
+        std::atomic<bool> m_shutdownRequested{ false };
+
+        // 종료 제한 시간 감시
+        std::thread m_watchdogThread;
+        std::mutex m_watchdogMutex;
+        std::condition_variable m_watchdogCondition;
+        bool m_completed{ false };
+
+        // 종료 단계별 경과 시간 (요청 시각 기준)
+        std::vector<std::pair<const char*, Clock::duration>> m_stages;
+        mutable std::mutex m_stageMutex;
+    };
+
+} // namespace AIEP
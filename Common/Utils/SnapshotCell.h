@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace AIEP {
+
+    /**
+     * @brief RCU 방식 입력 값 보관 (쓰기는 새 사본 게시, 읽기는 불변 스냅샷 참조)
+     *
+     * 쓰기 측은 새 사본을 만든 뒤 포인터만 교체하므로 읽는 쪽이 스냅샷을 오래 들고 있어도 대기하지 않습니다.
+     * 읽기 측이 받은 스냅샷은 이후 게시와 무관하게 변하지 않으며, 마지막 참조가 사라질 때 해제됩니다.
+     */
+    template <typename T>
+    class SnapshotCell {
+    public:
+        SnapshotCell()
+            : m_value(std::make_shared<const T>()) {}
+
+        void Publish(const T& value) {
+            m_value.store(std::make_shared<const T>(value), std::memory_order_release);
+            m_version.fetch_add(1, std::memory_order_release);
+        }
+
+        // 이미 구성된 불변 값 게시 (복사 없음)
+        void Publish(std::shared_ptr<const T> value) {
+            m_value.store(std::move(value), std::memory_order_release);
+            m_version.fetch_add(1, std::memory_order_release);
+        }
+
+        std::shared_ptr<const T> Load() const {
+            return m_value.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief 게시 횟수 (변경 여부 확인용)
+         */
+        uint64_t Version() const {
+            return m_version.load(std::memory_order_acquire);
+        }
+
+    private:
+        std::atomic<std::shared_ptr<const T>> m_value;
+        std::atomic<uint64_t> m_version{ 0 };
+    };
+
+} // namespace AIEP
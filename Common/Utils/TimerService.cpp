@@ -0,0 +1,340 @@
+#include "TimerService.h"
+#include "DebugPrint.h"
+#include "RealTimeProfile.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <sstream>
+#include <sys/timerfd.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace AIEP {
+
+    TimerService& TimerService::GetInstance() {
+        static TimerService instance;
+        return instance;
+    }
+
+    TimerService::~TimerService() {
+        Stop();
+    }
+
+    bool TimerService::OpenDescriptors() {
+        if (m_timerFd >= 0) {
+            return true;
+        }
+
+        // steady_clock 은 CLOCK_MONOTONIC 기준이므로 만료 시각을 그대로 절대 시각으로 사용
+        m_timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (m_timerFd < 0) {
+            DEBUG_ERROR_STREAM(TIMERSERVICE) << "timerfd_create failed" << std::endl;
+            return false;
+        }
+
+        m_wakeEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_wakeEventFd < 0) {
+            DEBUG_ERROR_STREAM(TIMERSERVICE) << "eventfd creation failed" << std::endl;
+            close(m_timerFd);
+            m_timerFd = -1;
+            return false;
+        }
+        return true;
+    }
+
+    int TimerService::SchedulePeriodic(Clock::duration period, TimerCallback callback, const std::string& name) {
+        if (period <= Clock::duration::zero() || !callback) {
+            DEBUG_ERROR_STREAM(TIMERSERVICE) << "Invalid periodic timer request" << std::endl;
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!OpenDescriptors()) {
+            return -1;
+        }
+
+        int timerId = m_nextTimerId++;
+        TimerEntry entry;
+        entry.name = name.empty() ? "timer" + std::to_string(timerId) : name;
+        entry.lateness = std::make_shared<LatencyRecorder<256>>();
+        entry.period = period;
+        entry.deadline = Clock::now() + period;
+        entry.callback = std::move(callback);
+
+        m_deadlines.emplace(entry.deadline, timerId);
+        m_timers.emplace(timerId, std::move(entry));
+        ArmNextDeadline();
+
+        DEBUG_STREAM(TIMERSERVICE) << "Periodic timer " << timerId << " (" << name << ") scheduled, period: "
+            << std::chrono::duration_cast<std::chrono::microseconds>(period).count() << " us" << std::endl;
+        return timerId;
+    }
+
+    int TimerService::ScheduleOnce(Clock::time_point deadline, TimerCallback callback) {
+        if (!callback) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!OpenDescriptors()) {
+            return -1;
+        }
+
+        int timerId = m_nextTimerId++;
+        TimerEntry entry;
+        entry.name = "once" + std::to_string(timerId);
+        entry.lateness = std::make_shared<LatencyRecorder<256>>();
+        entry.period = Clock::duration::zero();
+        entry.deadline = deadline;
+        entry.callback = std::move(callback);
+        entry.oneShot = true;
+
+        m_deadlines.emplace(entry.deadline, timerId);
+        m_timers.emplace(timerId, std::move(entry));
+        ArmNextDeadline();
+        return timerId;
+    }
+
+    void TimerService::SetPeriod(int timerId, Clock::duration period) {
+        if (period <= Clock::duration::zero()) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_timers.find(timerId);
+        if (it == m_timers.end() || it->second.oneShot || it->second.period == period) {
+            return;
+        }
+
+        TimerEntry& entry = it->second;
+        m_deadlines.erase({ entry.deadline, timerId });
+        entry.deadline = std::max(entry.deadline - entry.period + period, Clock::now());
+        entry.period = period;
+        m_deadlines.emplace(entry.deadline, timerId);
+        ArmNextDeadline();
+    }
+
+    void TimerService::Cancel(int timerId) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        auto it = m_timers.find(timerId);
+        if (it == m_timers.end()) {
+            // 만료되어 해제된 1회 작업의 콜백이 실행 중이면 종료까지 대기
+            if (std::this_thread::get_id() != m_timerThread.get_id()) {
+                m_dispatchDone.wait(lock, [this, timerId]() { return m_dispatchingTimerId != timerId; });
+            }
+            return;
+        }
+
+        m_deadlines.erase({ it->second.deadline, timerId });
+        if (it->second.oneShot) {
+            m_timers.erase(it);
+            ArmNextDeadline();
+            return;
+        }
+        if (it->second.overruns > 0) {
+            DEBUG_WARNING_STREAM(TIMERSERVICE) << "Timer " << timerId << " skipped " << it->second.overruns << " periods" << std::endl;
+        }
+        std::string jitterLine = FormatJitterLine(timerId, it->second);
+        DEBUG_STREAM(TIMERSERVICE) << jitterLine << std::endl;
+        if (m_retiredJitterLines.size() < 1024) {
+            m_retiredJitterLines.push_back(jitterLine);
+        }
+        m_timers.erase(it);
+        ArmNextDeadline();
+
+        // 콜백 실행 중이면 종료까지 대기 (콜백 내부에서 자기 자신을 해제하는 경우 제외)
+        if (std::this_thread::get_id() != m_timerThread.get_id()) {
+            m_dispatchDone.wait(lock, [this, timerId]() { return m_dispatchingTimerId != timerId; });
+        }
+    }
+
+    std::string TimerService::FormatJitterLine(int timerId, const TimerEntry& entry) {
+        auto summary = entry.lateness->GetSummary();
+        std::ostringstream line;
+        line << timerId << "," << entry.name
+            << "," << std::chrono::duration_cast<std::chrono::microseconds>(entry.period).count()
+            << "," << summary.count << "," << summary.p50_us << "," << summary.p90_us
+            << "," << summary.p99_us << "," << summary.max_us << "," << entry.overruns;
+        return line.str();
+    }
+
+    std::string TimerService::BuildJitterReport() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::ostringstream report;
+        report << "timer_id,name,period_us,count,p50_late_us,p90_late_us,p99_late_us,max_late_us,skipped_periods\n";
+        for (const auto& line : m_retiredJitterLines) {
+            report << line << "\n";
+        }
+        for (const auto& [timerId, entry] : m_timers) {
+            if (!entry.oneShot) {
+                report << FormatJitterLine(timerId, entry) << "\n";
+            }
+        }
+        return report.str();
+    }
+
+    bool TimerService::Start() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!OpenDescriptors()) {
+                return false;
+            }
+        }
+
+        if (m_running.exchange(true)) {
+            return true;
+        }
+
+        m_timerThread = std::thread([this]() { TimerLoop(); });
+        return true;
+    }
+
+    void TimerService::Stop() {
+        if (!m_running.exchange(false)) {
+            return;
+        }
+
+        WakeTimerThread();
+
+        if (m_timerThread.joinable()) {
+            m_timerThread.join();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_timers.clear();
+        m_deadlines.clear();
+
+        close(m_timerFd);
+        close(m_wakeEventFd);
+        m_timerFd = -1;
+        m_wakeEventFd = -1;
+    }
+
+    void TimerService::WakeTimerThread() {
+        uint64_t one = 1;
+        if (write(m_wakeEventFd, &one, sizeof(one)) < 0) {
+            DEBUG_ERROR_STREAM(TIMERSERVICE) << "Failed to wake timer thread" << std::endl;
+        }
+    }
+
+    void TimerService::ArmNextDeadline() {
+        struct itimerspec spec {};  // 등록된 타이머가 없으면 해제
+
+        if (!m_deadlines.empty()) {
+            auto sinceEpoch = m_deadlines.begin()->first.time_since_epoch();
+            auto sec = std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch);
+            spec.it_value.tv_sec = static_cast<time_t>(sec.count());
+            spec.it_value.tv_nsec = static_cast<long>(std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch - sec).count());
+            if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0) {
+                spec.it_value.tv_nsec = 1;
+            }
+        }
+
+        if (timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &spec, nullptr) < 0) {
+            DEBUG_ERROR_STREAM(TIMERSERVICE) << "timerfd_settime failed" << std::endl;
+        }
+    }
+
+    void TimerService::TimerLoop() {
+        struct pollfd fds[2] = {
+            { m_timerFd, POLLIN, 0 },
+            { m_wakeEventFd, POLLIN, 0 }
+        };
+
+        RealTimeProfile::ApplyCurrentThread("Timer");
+        DEBUG_STREAM(TIMERSERVICE) << "TimerLoop started" << std::endl;
+
+        while (m_running.load()) {
+            int ready = poll(fds, 2, -1); // 가장 가까운 만료 시각까지 대기
+            if (ready < 0) {
+                if (errno == EINTR) continue;
+                DEBUG_ERROR_STREAM(TIMERSERVICE) << "Timer poll failed" << std::endl;
+                break;
+            }
+
+            uint64_t count;
+            if (fds[1].revents & POLLIN) {
+                (void)read(m_wakeEventFd, &count, sizeof(count));
+            }
+
+            if (fds[0].revents & POLLIN) {
+                (void)read(m_timerFd, &count, sizeof(count));
+                DispatchExpired();
+            }
+        }
+
+        DEBUG_STREAM(TIMERSERVICE) << "TimerLoop ended" << std::endl;
+    }
+
+    void TimerService::DispatchExpired() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (m_running.load() && !m_deadlines.empty()) {
+            auto now = Clock::now();
+            auto [deadline, timerId] = *m_deadlines.begin();
+            if (deadline > now) {
+                break;
+            }
+            m_deadlines.erase(m_deadlines.begin());
+
+            TimerEntry& entry = m_timers.at(timerId);
+            entry.lateness->Record(now - deadline);
+
+            if (entry.oneShot) {
+                // 1회 작업은 재등록 없이 콜백 후 해제 (실행 중 Cancel 은 콜백 종료까지 대기)
+                TimerCallback callback = std::move(entry.callback);
+                m_timers.erase(timerId);
+                m_dispatchingTimerId = timerId;
+                lock.unlock();
+
+                try {
+                    callback(deadline);
+                }
+                catch (const std::exception& e) {
+                    DEBUG_ERROR_STREAM(TIMERSERVICE) << "Timer " << timerId << " callback failed: " << e.what() << std::endl;
+                }
+
+                lock.lock();
+                m_dispatchingTimerId = 0;
+                m_dispatchDone.notify_all();
+                continue;
+            }
+
+            // 다음 만료 시각은 이전 예정 시각 기준 (처리 시간이 누적되지 않음), 밀린 주기는 건너뜀
+            entry.deadline += entry.period;
+            if (entry.deadline <= now) {
+                auto missed = (now - entry.deadline) / entry.period + 1;
+                entry.deadline += entry.period * missed;
+                entry.overruns += static_cast<uint64_t>(missed);
+            }
+            m_deadlines.emplace(entry.deadline, timerId);
+
+            // 콜백은 잠금 해제 후 호출 (콜백 내에서 Schedule/Cancel 호출 가능)
+            TimerCallback callback = entry.callback;
+            m_dispatchingTimerId = timerId;
+            lock.unlock();
+
+            try {
+                callback(deadline);
+            }
+            catch (const std::exception& e) {
+                DEBUG_ERROR_STREAM(TIMERSERVICE) << "Timer " << timerId << " callback failed: " << e.what() << std::endl;
+            }
+
+            lock.lock();
+            m_dispatchingTimerId = 0;
+            m_dispatchDone.notify_all();
+        }
+
+        if (m_running.load()) {
+            ArmNextDeadline();
+        }
+    }
+
+} // namespace AIEP
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <map>
+#include <set>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <functional>
+#include <condition_variable>
+
+#include "LatencyRecorder.h"
+
+namespace AIEP {
+
+    /**
+     * @brief 프로세스 공용 주기 타이머 (timerfd 기반, Linux)
+     *
+     * 모든 주기 작업을 절대 시각(steady_clock) 기준으로 관리하므로 처리 시간이 주기에 누적되지 않습니다.
+     * 타이머 스레드는 가장 가까운 만료 시각까지 poll()에서 대기하며 중간에 깨어나지 않습니다.
+     * 콜백은 타이머 스레드에서 호출되므로 짧게 유지하고, 무거운 작업은 소유 스레드를 깨워 처리합니다.
+     */
+    class TimerService {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using TimerCallback = std::function<void(Clock::time_point deadline)>;
+
+        static TimerService& GetInstance();
+
+        /**
+         * @brief 주기 작업 등록 (Start 전후 모두 가능)
+         * @param period 주기 (0 이하이면 등록 실패)
+         * @param callback 만료 시 타이머 스레드에서 호출되는 콜백 (인자: 예정 만료 시각)
+         * @param name 지터 보고서에 표시할 이름
+         * @return 타이머 ID (실패 시 -1)
+         */
+        int SchedulePeriodic(Clock::duration period, TimerCallback callback, const std::string& name = "");
+
+        /**
+         * @brief 1회 작업 등록 (시간 초과 감시 등, 지터 보고서에는 포함하지 않음)
+         * @param deadline 만료 시각 (이미 지났으면 즉시)
+         * @return 타이머 ID (실패 시 -1), 콜백 종료 후 자동 해제
+         */
+        int ScheduleOnce(Clock::time_point deadline, TimerCallback callback);
+
+        /**
+         * @brief 주기 변경 (다음 만료 시각 = 직전 만료 시각 + 새 주기, 이미 지났으면 즉시)
+         */
+        void SetPeriod(int timerId, Clock::duration period);
+
+        /**
+         * @brief 주기 작업 해제
+         *
+         * 반환 후에는 콜백이 호출되지 않습니다 (실행 중인 콜백은 종료까지 대기, 콜백 내부 호출 시 제외).
+         */
+        void Cancel(int timerId);
+
+        /**
+         * @brief 주기 작업별 만료 지연(예정 시각 대비 콜백 시작 시각) 백분위 보고서
+         *
+         * 해제된 작업의 통계도 포함합니다.
+         */
+        std::string BuildJitterReport() const;
+
+        /**
+         * @brief 타이머 스레드 시작/정지
+         */
+        bool Start();
+        void Stop();
+
+    private:
+        TimerService() = default;
+        ~TimerService();
+
+        TimerService(const TimerService&) = delete;
+        TimerService& operator=(const TimerService&) = delete;
+
+        bool OpenDescriptors();
+        void TimerLoop();
+        void ArmNextDeadline(); // m_mutex 보유 상태에서 호출
+        void DispatchExpired();
+        void WakeTimerThread();
+
+        struct TimerEntry;
+        static std::string FormatJitterLine(int timerId, const TimerEntry& entry);
+
+        struct TimerEntry {
+            std::string name;
+            Clock::duration period;
+            Clock::time_point deadline;
+            TimerCallback callback;
+            uint64_t overruns{ 0 };     // 처리 지연으로 건너뛴 주기 수
+            bool oneShot{ false };
+            std::shared_ptr<LatencyRecorder<256>> lateness;
+        };
+
+        int m_timerFd{ -1 };
+        int m_wakeEventFd{ -1 };                                // 등록 변경/Stop() 시 poll() 즉시 해제용
+        std::map<int, TimerEntry> m_timers;
+        std::set<std::pair<Clock::time_point, int>> m_deadlines; // 만료 시각 순 정렬
+        int m_nextTimerId{ 1 };
+        std::vector<std::string> m_retiredJitterLines;         // 해제된 작업의 지터 통계
+
+        int m_dispatchingTimerId{ 0 };                          // 현재 콜백 실행 중인 타이머
+        std::condition_variable m_dispatchDone;
+
+        std::thread m_timerThread;
+        std::atomic<bool> m_running{ false };
+        mutable std::mutex m_mutex;
+    };
+
+} // namespace AIEP
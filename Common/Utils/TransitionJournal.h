@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace AIEP {
+
+    /**
+     * @brief 고정 크기 lock-free 상태 전이 기록 (최근 Capacity 개 유지)
+     *
+     * 기록하는 쪽은 fetch_add 한 번으로 슬롯을 확보하고, 슬롯별 순번으로 쓰기 완료를 표시합니다.
+     * 읽는 쪽은 쓰기 중이거나 덮어쓰인 슬롯을 건너뛰므로 기록 스레드를 막지 않습니다.
+     * 상태/원인 값은 uint8_t 로 변환하여 저장합니다.
+     *
+     * @tparam Capacity 슬롯 수 (2의 거듭제곱)
+     */
+    template <size_t Capacity>
+    class TransitionJournal {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        struct Entry {
+            uint64_t sequence{ 0 };     // 1부터 증가하는 전이 순번
+            std::chrono::steady_clock::time_point time{};
+            uint8_t fromState{ 0 };
+            uint8_t toState{ 0 };
+            uint8_t cause{ 0 };
+        };
+
+        TransitionJournal() = default;
+        TransitionJournal(const TransitionJournal&) = delete;
+        TransitionJournal& operator=(const TransitionJournal&) = delete;
+
+        /**
+         * @brief 전이 기록 (여러 스레드에서 동시 호출 가능, 할당 없음)
+         */
+        void Record(uint8_t fromState, uint8_t toState, uint8_t cause,
+            std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now()) {
+            uint64_t sequence = m_nextSequence.fetch_add(1, std::memory_order_relaxed) + 1;
+            Slot& slot = m_slots[sequence & (Capacity - 1)];
+
+            slot.sequence.store(0, std::memory_order_relaxed);     // 쓰기 중 표시
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.time_ns.store(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count()), std::memory_order_relaxed);
+            slot.transition.store(static_cast<uint64_t>(fromState) | (static_cast<uint64_t>(toState) << 8)
+                | (static_cast<uint64_t>(cause) << 16), std::memory_order_relaxed);
+            slot.sequence.store(sequence, std::memory_order_release);
+        }
+
+        /**
+         * @brief 누적 기록 수
+         */
+        uint64_t Count() const {
+            return m_nextSequence.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief 최근 기록을 순번 순으로 복사 (쓰기 중인 슬롯은 제외)
+         */
+        std::vector<Entry> Snapshot() const {
+            std::vector<Entry> entries;
+            uint64_t last = m_nextSequence.load(std::memory_order_acquire);
+            uint64_t first = (last > Capacity) ? last - Capacity + 1 : 1;
+            entries.reserve(static_cast<size_t>(last - first + 1));
+
+            for (uint64_t sequence = first; sequence <= last; ++sequence) {
+                const Slot& slot = m_slots[sequence & (Capacity - 1)];
+                if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+                    continue;
+                }
+                uint64_t time_ns = slot.time_ns.load(std::memory_order_relaxed);
+                uint64_t transition = slot.transition.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+                    continue;   // 읽는 동안 덮어쓰임
+                }
+
+                Entry entry;
+                entry.sequence = sequence;
+                entry.time = std::chrono::steady_clock::time_point(
+                    std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(time_ns)));
+                entry.fromState = static_cast<uint8_t>(transition & 0xFF);
+                entry.toState = static_cast<uint8_t>((transition >> 8) & 0xFF);
+                entry.cause = static_cast<uint8_t>((transition >> 16) & 0xFF);
+                entries.push_back(entry);
+            }
+            return entries;
+        }
+
+    private:
+        struct Slot {
+            std::atomic<uint64_t> sequence{ 0 };
+            std::atomic<uint64_t> time_ns{ 0 };
+            std::atomic<uint64_t> transition{ 0 };
+        };
+
+        std::array<Slot, Capacity> m_slots{};
+        std::atomic<uint64_t> m_nextSequence{ 0 };
+    };
+
+} // namespace AIEP
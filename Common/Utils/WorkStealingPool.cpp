@@ -0,0 +1,273 @@
+#include "WorkStealingPool.h"
+#include "DebugPrint.h"
+#include "RealTimeProfile.h"
+
+#include <algorithm>
+#include <exception>
+#include <sstream>
+
+namespace AIEP {
+
+    namespace {
+        // 현재 스레드가 작업자이면 그 번호 (하위 작업을 자기 큐에 넣기 위함)
+        thread_local const void* t_currentPool = nullptr;
+        thread_local size_t t_workerIndex = 0;
+    }
+
+    WorkStealingPool& WorkStealingPool::GetInstance() {
+        static WorkStealingPool instance;
+        return instance;
+    }
+
+    WorkStealingPool::~WorkStealingPool() {
+        Stop();
+    }
+
+    bool WorkStealingPool::Start(size_t workerCount) {
+        if (m_running.exchange(true)) {
+            return true;
+        }
+
+        if (workerCount == 0) {
+            workerCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        m_workers.clear();
+        for (size_t i = 0; i < workerCount; ++i) {
+            m_workers.push_back(std::make_unique<Worker>());
+        }
+        for (size_t i = 0; i < workerCount; ++i) {
+            m_workers[i]->thread = std::thread([this, i]() { WorkerLoop(i); });
+        }
+
+        DEBUG_STREAM(WORKPOOL) << "WorkStealingPool started with " << workerCount << " workers" << std::endl;
+        return true;
+    }
+
+    void WorkStealingPool::Stop() {
+        if (!m_running.exchange(false)) {
+            return;
+        }
+
+        NotifyWorkAvailable();
+        for (auto& worker : m_workers) {
+            if (worker->thread.joinable()) {
+                worker->thread.join();
+            }
+        }
+
+        size_t dropped = m_pendingCount.exchange(0);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_submitted = {};
+        }
+        m_workers.clear();
+
+        if (dropped > 0) {
+            DEBUG_WARNING_STREAM(WORKPOOL) << "WorkStealingPool stopped with " << dropped << " pending jobs" << std::endl;
+        }
+        DEBUG_STREAM(WORKPOOL) << BuildReport() << std::endl;
+    }
+
+    bool WorkStealingPool::Submit(Job job, Clock::time_point deadline) {
+        if (!job || !m_running.load()) {
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Task task;
+            task.job = std::move(job);
+            task.deadline = deadline;
+            task.submitTime = Clock::now();
+            task.sequence = m_nextSequence++;
+            m_submitted.push(std::move(task));
+            m_pendingCount.fetch_add(1);
+        }
+        m_workAvailable.notify_one();
+        return true;
+    }
+
+    void WorkStealingPool::ParallelFor(size_t count, const std::function<void(size_t index)>& body) {
+        if (count == 0) {
+            return;
+        }
+
+        if (!m_running.load() || m_workers.size() <= 1 || count == 1) {
+            for (size_t i = 0; i < count; ++i) {
+                body(i);
+            }
+            return;
+        }
+
+        struct SharedState {
+            std::atomic<size_t> next{ 0 };
+            std::atomic<size_t> done{ 0 };
+            size_t count{ 0 };
+            const std::function<void(size_t)>* body{ nullptr };
+            std::mutex mutex;
+            std::condition_variable finished;
+            std::exception_ptr error;
+        };
+
+        auto state = std::make_shared<SharedState>();
+        state->count = count;
+        state->body = &body;
+
+        // 남은 인덱스를 하나씩 가져가 실행 (인덱스를 못 가져간 도우미는 body 에 접근하지 않음)
+        auto runIndices = [state]() {
+            size_t index;
+            while ((index = state->next.fetch_add(1)) < state->count) {
+                try {
+                    (*state->body)(index);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    if (!state->error) {
+                        state->error = std::current_exception();
+                    }
+                }
+                if (state->done.fetch_add(1) + 1 == state->count) {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    state->finished.notify_all();
+                }
+            }
+        };
+
+        size_t helperCount = std::min(count - 1, m_workers.size());
+        bool onWorker = (t_currentPool == this);
+        for (size_t i = 0; i < helperCount; ++i) {
+            if (onWorker) {
+                PushLocal(t_workerIndex, runIndices);
+            }
+            else if (!Submit(runIndices, Clock::now())) {
+                break;
+            }
+        }
+
+        runIndices();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finished.wait(lock, [&state]() { return state->done.load() == state->count; });
+        if (state->error) {
+            std::rethrow_exception(state->error);
+        }
+    }
+
+    void WorkStealingPool::WorkerLoop(size_t index) {
+        t_currentPool = this;
+        t_workerIndex = index;
+        RealTimeProfile::ApplyCurrentThread("Engagement");
+
+        while (m_running.load()) {
+            Job job;
+            if (PopLocal(index, job)) {
+                job();
+                continue;
+            }
+
+            Task task;
+            if (PopSubmitted(task)) {
+                RunSubmitted(task);
+                continue;
+            }
+
+            if (Steal(index, job)) {
+                m_stolenCount.fetch_add(1, std::memory_order_relaxed);
+                job();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_workAvailable.wait(lock, [this]() { return !m_running.load() || m_pendingCount.load() > 0; });
+        }
+
+        t_currentPool = nullptr;
+    }
+
+    bool WorkStealingPool::PopLocal(size_t index, Job& job) {
+        Worker& worker = *m_workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.local.empty()) {
+            return false;
+        }
+        job = std::move(worker.local.back());
+        worker.local.pop_back();
+        m_pendingCount.fetch_sub(1);
+        return true;
+    }
+
+    bool WorkStealingPool::PopSubmitted(Task& task) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_submitted.empty()) {
+            return false;
+        }
+        task = m_submitted.top();
+        m_submitted.pop();
+        m_pendingCount.fetch_sub(1);
+        return true;
+    }
+
+    bool WorkStealingPool::Steal(size_t thiefIndex, Job& job) {
+        for (size_t offset = 1; offset < m_workers.size(); ++offset) {
+            Worker& victim = *m_workers[(thiefIndex + offset) % m_workers.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.local.empty()) {
+                job = std::move(victim.local.front());
+                victim.local.pop_front();
+                m_pendingCount.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkStealingPool::PushLocal(size_t index, Job job) {
+        {
+            Worker& worker = *m_workers[index];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.local.push_back(std::move(job));
+            m_pendingCount.fetch_add(1);
+        }
+        NotifyWorkAvailable();
+    }
+
+    void WorkStealingPool::RunSubmitted(Task& task) {
+        auto start = Clock::now();
+        m_queueWait.Record(start - task.submitTime);
+
+        try {
+            task.job();
+        }
+        catch (const std::exception& e) {
+            DEBUG_ERROR_STREAM(WORKPOOL) << "Planning job failed: " << e.what() << std::endl;
+        }
+
+        auto finish = Clock::now();
+        m_completedCount.fetch_add(1, std::memory_order_relaxed);
+        if (finish > task.deadline) {
+            m_deadlineMissCount.fetch_add(1, std::memory_order_relaxed);
+            m_deadlineOverrun.Record(finish - task.deadline);
+        }
+    }
+
+    void WorkStealingPool::NotifyWorkAvailable() {
+        // 대기 조건 확인과 알림 사이에 끼어들지 않도록 잠금 후 알림
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_workAvailable.notify_all();
+    }
+
+    std::string WorkStealingPool::BuildReport() const {
+        auto wait = m_queueWait.GetSummary();
+        auto overrun = m_deadlineOverrun.GetSummary();
+
+        std::ostringstream report;
+        report << "WorkStealingPool jobs: " << m_completedCount.load()
+            << ", deadline misses: " << m_deadlineMissCount.load()
+            << ", stolen sub-tasks: " << m_stolenCount.load()
+            << " - queue wait (us) p50: " << wait.p50_us << " p99: " << wait.p99_us << " max: " << wait.max_us
+            << ", overrun (us) p50: " << overrun.p50_us << " max: " << overrun.max_us;
+        return report.str();
+    }
+
+} // namespace AIEP
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "LatencyRecorder.h"
+
+namespace AIEP {
+
+    /**
+     * @brief 프로세스 공용 교전계획 작업 풀 (작업자별 큐 + 작업 가로채기)
+     *
+     * 외부에서 제출한 작업은 마감 시각이 이른 순서로 실행되고, 작업 안에서 나눈 하위 작업(ParallelFor)은
+     * 제출한 작업자의 큐에 쌓였다가 유휴 작업자가 가로채 실행합니다.
+     * 마감 시각은 실행 순서와 마감 초과 통계에만 사용하며, 초과한 작업도 취소하지 않습니다.
+     */
+    class WorkStealingPool {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Job = std::function<void()>;
+
+        static WorkStealingPool& GetInstance();
+
+        /**
+         * @brief 작업자 스레드 시작
+         * @param workerCount 작업자 수 (0 이면 CPU 코어 수)
+         */
+        bool Start(size_t workerCount = 0);
+
+        /**
+         * @brief 작업자 스레드 정지 (대기 중인 작업은 실행하지 않음)
+         */
+        void Stop();
+
+        /**
+         * @brief 작업 제출 (어느 스레드에서나 호출 가능)
+         * @param deadline 완료 마감 시각 (이른 작업 먼저 실행)
+         * @return 풀이 정지 상태이면 false (작업은 실행되지 않음)
+         */
+        bool Submit(Job job, Clock::time_point deadline);
+
+        /**
+         * @brief body(0) ~ body(count - 1) 을 유휴 작업자에 나누어 실행하고 모두 끝날 때까지 대기
+         *
+         * 호출 스레드도 함께 실행하므로 작업자 안에서 호출해도 교착되지 않습니다.
+         * 풀이 정지 상태이면 호출 스레드에서 순서대로 실행합니다. 첫 번째 예외를 호출 스레드로 전달합니다.
+         */
+        void ParallelFor(size_t count, const std::function<void(size_t index)>& body);
+
+        size_t WorkerCount() const { return m_workers.size(); }
+
+        /**
+         * @brief 제출 작업의 대기 시간, 마감 초과 통계
+         */
+        std::string BuildReport() const;
+
+    private:
+        WorkStealingPool() = default;
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        struct Task {
+            Job job;
+            Clock::time_point deadline;
+            Clock::time_point submitTime;
+            uint64_t sequence{ 0 };
+        };
+
+        struct LaterDeadline {
+            bool operator()(const Task& a, const Task& b) const {
+                return (a.deadline != b.deadline) ? (a.deadline > b.deadline) : (a.sequence > b.sequence);
+            }
+        };
+
+        struct Worker {
+            std::mutex mutex;
+            std::deque<Job> local;      // 이 작업자가 나눈 하위 작업 (소유자는 뒤에서, 다른 작업자는 앞에서 꺼냄)
+            std::thread thread;
+        };
+
+        void WorkerLoop(size_t index);
+        bool PopLocal(size_t index, Job& job);
+        bool PopSubmitted(Task& task);
+        bool Steal(size_t thiefIndex, Job& job);
+        void PushLocal(size_t index, Job job);
+        void RunSubmitted(Task& task);
+        void NotifyWorkAvailable();
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+        std::priority_queue<Task, std::vector<Task>, LaterDeadline> m_submitted;   // m_mutex 보호
+        uint64_t m_nextSequence{ 0 };
+        std::atomic<size_t> m_pendingCount{ 0 };   // 모든 큐의 대기 작업 수
+        std::atomic<bool> m_running{ false };
+        mutable std::mutex m_mutex;
+        std::condition_variable m_workAvailable;
+
+        // 제출 작업 통계
+        LatencyRecorder<256> m_queueWait;          // 제출 ~ 실행 시작
+        LatencyRecorder<256> m_deadlineOverrun;    // 마감 초과 시 초과 시간
+        std::atomic<uint64_t> m_completedCount{ 0 };
+        std::atomic<uint64_t> m_deadlineMissCount{ 0 };
+        std::atomic<uint64_t> m_stolenCount{ 0 };
+    };
+
+} // namespace AIEP
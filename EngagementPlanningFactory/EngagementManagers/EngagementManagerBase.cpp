@@ -1,24 +1,45 @@
 #include "EngagementManagerBase.h"
+#include "../../Common/Utils/TimerService.h"
+#include "../../Common/Utils/WorkStealingPool.h"
+#include "../../Common/Utils/ShutdownController.h"
 #include "utils/AIEP_DataConverter.h"
+#include <cassert>
 #include <cstring>
+#include <cmath>
 
 namespace AIEP {
+    namespace {
+        // 근거리 두 지점 간 거리 (등장방형 근사, m)
+        double ApproximateDistance_m(double lat1_deg, double lon1_deg, double lat2_deg, double lon2_deg) {
+            constexpr double METERS_PER_DEGREE = 111320.0;
+            constexpr double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+            double north = (lat2_deg - lat1_deg) * METERS_PER_DEGREE;
+            double east = (lon2_deg - lon1_deg) * METERS_PER_DEGREE * std::cos(0.5 * (lat1_deg + lat2_deg) * DEG_TO_RAD);
+            return std::hypot(north, east);
+        }
+    }
+
     // =============================================================================
     // EngagementManagerBase 구현
     // =============================================================================
 
     EngagementManagerBase::EngagementManagerBase(ST_WA_SESSION weaponAssignInfo, std::shared_ptr<AIEP::DdsComm> ddsComm)
-        : m_tubeNumber(weaponAssignInfo.enTubeNum())
-        , m_weaponKind(weaponAssignInfo.enWeaponType())
+        : EngagementManagerBase(weaponAssignInfo.enTubeNum(), weaponAssignInfo.enWeaponType(), ddsComm)
+    {
+        m_weaponAssignmentInfo = weaponAssignInfo;
+        m_assignmentBound.store(true);
+    }
+
+    EngagementManagerBase::EngagementManagerBase(int tubeNumber, uint32_t weaponKind, std::shared_ptr<AIEP::DdsComm> ddsComm)
+        : m_tubeNumber(tubeNumber)
+        , m_weaponKind(weaponKind)
         , m_ddsComm(ddsComm)
         , m_weaponSpec{}
-        , m_weaponAssignmentInfo(weaponAssignInfo)
-        , m_ownShipInfo{}
-        , m_targetInfo{}
-        , m_paInfo{}
-        , m_waypointCmd{}
+        , m_weaponAssignmentInfo{}
+        , m_processShutdown(ShutdownController::GetInstance().Token())
     {
         WeaponSpecInitialization();
+        TakeEnvironmentSnapshot();
         m_initialized.store(true);
 
         DEBUG_STREAM(ENGAGEMENT) << "EngagementManagerBase created for Tube " << m_tubeNumber
@@ -26,17 +47,50 @@ namespace AIEP {
     }
 
     EngagementManagerBase::~EngagementManagerBase() {
-        Shutdown();
+        // 산출 작업이 순수 가상 함수를 호출하므로 파생 클래스 소멸자에서 먼저 Shutdown() 해야 함
+        assert(!m_initialized.load() && "derived engagement manager must call Shutdown() in its destructor");
     }
 
     void EngagementManagerBase::WeaponSpecInitialization()
     {
-        auto& config = ConfigManager::GetInstance();
-        if (!config.LoadFromFile("config.ini")) {
+        // 설정 파일은 프로세스 시작 시 한 번만 로드됨, 여기서는 현재 스냅샷만 받아 둠
+        auto config = ConfigManager::GetInstance().GetSnapshot();
+        m_config.Publish(config);
+        m_weaponSpec = config->GetWeaponSpec(m_weaponKind);
+    }
+
+    void EngagementManagerBase::OnConfigurationChanged(const ConfigChange& change)
+    {
+        // 다른 무장 제원만 바뀐 경우 무시
+        if (!change.IsWeaponChanged(m_weaponKind) && !change.businessLogicChanged) {
             return;
         }
 
-        m_weaponSpec = config.GetWeaponSpec(m_weaponKind);
+        // 스냅샷만 교체하고 반영은 산출 작업에서 수행 (실행 중인 산출/송신은 멈추지 않음)
+        m_config.Publish(change.current);
+        DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " configuration changed"
+            << (change.IsWeaponChanged(m_weaponKind) ? " (weapon specification)" : "") << std::endl;
+
+        // 사전 생성 상태이면 할당 연결 후 첫 주기에서 반영
+        if (IsAssignmentBound()) {
+            RequestImmediatePlanCycle("configuration changed");
+        }
+    }
+
+    void EngagementManagerBase::ApplyConfiguration(const ConfigSnapshot& config)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_dataMutex);
+            m_weaponSpec = config.GetWeaponSpec(m_weaponKind);
+        }
+
+        double geometryInterval_sec = config.GetWeaponSpec(m_weaponKind).launchGeometryInterval_sec;
+        if (m_geometryTimerId >= 0 && geometryInterval_sec != m_geometryInterval_sec.load()) {
+            m_geometryInterval_sec.store(geometryInterval_sec);
+            TimerService::GetInstance().SetPeriod(m_geometryTimerId,
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(geometryInterval_sec)));
+        }
+        DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " weapon specification reloaded" << std::endl;
     }
 
     void EngagementManagerBase::Shutdown() {
@@ -46,89 +100,353 @@ namespace AIEP {
 
         DEBUG_STREAM(ENGAGEMENT) << "EngagementManagerBase shutdown for Tube " << m_tubeNumber << std::endl;
 
-        m_shutdown.store(true);
+        // 이후 설정 변경 통지 없음 (진행 중인 통지는 완료 대기)
+        if (m_configSubscriptionId >= 0) {
+            ConfigManager::GetInstance().Unsubscribe(m_configSubscriptionId);
+            m_configSubscriptionId = -1;
+        }
+
+        TimerService::GetInstance().Cancel(m_planTimerId);
+        TimerService::GetInstance().Cancel(m_geometryTimerId);
+
+        {
+            std::lock_guard<std::mutex> lock(m_cycleMutex);
+            m_shutdown.store(true);
+        }
 
         m_initialized.store(false);
-        
-        if (m_engagementPlanThread.joinable()) {
-            m_engagementPlanThread.join();
+
+        // 풀에서 실행 중인 산출 작업 완료 대기 (이후 새 작업은 제출되지 않음)
+        {
+            std::unique_lock<std::mutex> lock(m_cycleMutex);
+            m_cycleCondition.wait(lock, [this]() { return !m_planCycleQueued; });
+        }
+
+        // 대기 중인 비동기 흐름 취소 후 종료 대기 (취소된 흐름은 공용 작업 풀에서 바로 끝남)
+        CancelFlows("shutdown");
+        {
+            std::unique_lock<std::mutex> lock(m_flowMutex);
+            m_flowsFinished.wait(lock, [this]() { return m_activeFlows == 0; });
         }
 
+        auto publish = m_inputPublishLatency.GetSummary();
+        DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " input publish time (us) over " << publish.count << " updates -"
+            << " p50: " << publish.p50_us << " p99: " << publish.p99_us << " max: " << publish.max_us << std::endl;
+        DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " ownship samples received: " << m_ownShipReceived.load()
+            << ", processed: " << m_ownShipProcessed << std::endl;
+
     }
 
     void EngagementManagerBase::Reset() {
-        std::lock_guard<std::mutex> lock(m_dataMutex);
-
-        m_engagementPlanReady.store(false);
+        SetEngagementPlanReady(false);
         m_isLaunched.store(false);
-        m_ownShipInfo = NAVINF_SHIP_NAVIGATION_INFO{};
-        m_targetInfo = TRKMGR_SYSTEMTARGET_INFO{};
-        m_paInfo = CMSHCI_AIEP_PA_INFO{};
-        m_waypointCmd = CMSHCI_AIEP_WPN_GEO_WAYPOINTS{};
+        m_ownShipInput.Publish(NAVINF_SHIP_NAVIGATION_INFO{});
+        m_targetInput.Publish(TRKMGR_SYSTEMTARGET_INFO{});
+        m_paInput.Publish(CMSHCI_AIEP_PA_INFO{});
+        m_waypointInput.Publish(CMSHCI_AIEP_WPN_GEO_WAYPOINTS{});
 
         DEBUG_STREAM(ENGAGEMENT) << "EngagementManagerBase reset for Tube " << m_tubeNumber << std::endl;
     }
 
     void EngagementManagerBase::StartEngagementPlanManager()
     {
-        m_engagementPlanThread = std::thread([this]() {WorkerLoop();});
+        // 설정 변경 구독은 생성이 끝난 뒤 시작 (생성자에서 this 를 넘기면 파생 객체 생성 전에 통지될 수 있음)
+        // 생성 후 구독 전까지의 변경분은 현재 스냅샷으로 교체해 첫 산출 주기에서 반영
+        if (m_configSubscriptionId < 0) {
+            m_configSubscriptionId = ConfigManager::GetInstance().Subscribe(
+                [this](const ConfigChange& change) { OnConfigurationChanged(change); });
+            m_config.Publish(ConfigManager::GetInstance().GetSnapshot());
+        }
+
+        // 교전계획 산출 주기는 공용 타이머에서 관리 (만료 시 공용 작업 풀에 산출 작업 제출, 마감은 다음 주기)
+        auto config = m_config.Load();
+        const auto& businessConfig = config->businessLogic;
+        m_planInterval_sec = businessConfig.engagementPlanUpdateInterval_sec;
+        m_planDeadline_sec.store(m_planInterval_sec);
+        m_planTimerId = TimerService::GetInstance().SchedulePeriodic(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(businessConfig.engagementPlanUpdateInterval_sec)),
+            [this](std::chrono::steady_clock::time_point deadline) {
+                SubmitPlanCycle(deadline + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(m_planDeadline_sec.load())));
+            },
+            "EngagementPlan.Tube" + std::to_string(m_tubeNumber));
+        if (m_planTimerId < 0) {
+            DEBUG_ERROR_STREAM(ENGAGEMENT) << "Engagement plan timer registration failed for Tube " << m_tubeNumber << std::endl;
+        }
+
+        // 발사 가능 구역 판단은 산출 주기(입력 변화가 없으면 늘어남)와 별도로 고정 주기 수행
+        m_geometryInterval_sec.store(config->GetWeaponSpec(m_weaponKind).launchGeometryInterval_sec);
+        m_geometryTimerId = TimerService::GetInstance().SchedulePeriodic(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(m_geometryInterval_sec.load())),
+            [this](std::chrono::steady_clock::time_point deadline) {
+                SubmitGeometryEvaluation(deadline + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(m_geometryInterval_sec.load())));
+            },
+            "LaunchGeometry.Tube" + std::to_string(m_tubeNumber));
+        if (m_geometryTimerId < 0) {
+            DEBUG_ERROR_STREAM(ENGAGEMENT) << "Launch geometry timer registration failed for Tube " << m_tubeNumber << std::endl;
+        }
+
+        // 할당 직후 첫 산출은 주기를 기다리지 않고 작업 풀에서 수행
+        SubmitPlanCycle(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(m_planDeadline_sec.load())));
+    }
+
+    void EngagementManagerBase::SubmitPlanCycle(std::chrono::steady_clock::time_point deadline) {
+        std::lock_guard<std::mutex> lock(m_cycleMutex);
+        if (m_shutdown.load() || m_processShutdown.IsCancelled()) {
+            return;
+        }
+
+        m_planCycleDue = true;
+        if (m_planCycleQueued) {
+            return;     // 실행 중인 작업이 끝난 뒤 한 주기 더 산출
+        }
+
+        m_planCycleQueued = WorkStealingPool::GetInstance().Submit([this]() { RunPendingPlanCycles(); }, deadline);
+        if (!m_planCycleQueued) {
+            DEBUG_ERROR_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " plan cycle not submitted: work pool stopped" << std::endl;
+        }
     }
 
-    void EngagementManagerBase::WorkerLoop() {
-        auto lastCalculation = std::chrono::steady_clock::now();
-        auto lastResultSend = std::chrono::steady_clock::now();
+    void EngagementManagerBase::SubmitGeometryEvaluation(std::chrono::steady_clock::time_point deadline) {
+        // 마지막 판단 이후 새 항법 정보가 없으면 생략
+        if (m_ownShipInput.Version() == m_processedOwnShipVersion.load()) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_cycleMutex);
+        if (m_shutdown.load() || m_processShutdown.IsCancelled()) {
+            return;
+        }
+
+        m_geometryDue = true;
+        if (m_planCycleQueued) {
+            return;     // 실행 중인 작업이 끝난 뒤 판단
+        }
+
+        m_planCycleQueued = WorkStealingPool::GetInstance().Submit([this]() { RunPendingPlanCycles(); }, deadline);
+        if (!m_planCycleQueued) {
+            DEBUG_ERROR_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " launch geometry evaluation not submitted: work pool stopped" << std::endl;
+        }
+    }
+
+    // 공용 작업 풀에서 실행 (관리자당 한 번에 하나만 실행되므로 산출 상태는 잠금 없이 사용)
+    void EngagementManagerBase::RunPendingPlanCycles() {
+        while (true) {
+            bool runPlanCycle;
+            {
+                std::lock_guard<std::mutex> lock(m_cycleMutex);
+                if ((!m_planCycleDue && !m_geometryDue) || m_shutdown.load()) {
+                    m_planCycleQueued = false;
+                    m_cycleCondition.notify_all();
+                    return;
+                }
 
-        DEBUG_STREAM(ENGAGEMENT) << "EngagementManager WorkerLoop started for Tube " << m_tubeNumber << std::endl;
+                // 산출 주기도 구역 판단을 포함하므로 함께 요청되면 산출 주기만 실행
+                runPlanCycle = m_planCycleDue;
+                m_planCycleDue = false;
+                m_geometryDue = false;
+            }
 
-        while (!m_shutdown.load()) {
-            auto now = std::chrono::steady_clock::now();
-            // TODO. timer 개선해야 함
-            // 1초마다 결과 송신
-            if (now - lastResultSend >= std::chrono::seconds(1)) {
-                UpdateEngagementPlanResult();
-                SendEngagementPlanResult();
-                lastResultSend = now;
+            try {
+                if (runPlanCycle) {
+                    RunPlanCycle();
+                }
+                else {
+                    EvaluateLaunchGeometry();
+                }
+            }
+            catch (const std::exception& e) {
+                DEBUG_ERROR_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " plan cycle failed: " << e.what() << std::endl;
             }
+        }
+    }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    void EngagementManagerBase::RunPlanCycle() {
+        // 주기 시작 시 입력 스냅샷 (산출 중 수신되는 입력/설정은 다음 주기에 반영)
+        uint64_t previousWaypointsVersion = m_cycleInputs.waypointsVersion;
+        auto previousConfig = m_cycleInputs.config;
+        TakeEnvironmentSnapshot();
+        if (m_cycleInputs.config != previousConfig) {
+            ApplyConfiguration(*m_cycleInputs.config);
+        }
+        if (m_cycleInputs.waypointsVersion != previousWaypointsVersion) {
+            SetWaypoints();
         }
+        m_inLaunchGeometry = IsInValidLaunchGeometry();
 
-        DEBUG_STREAM(ENGAGEMENT) << "EngagementManager WorkerLoop ended for Tube " << m_tubeNumber << std::endl;
+        // 프로세스 종료가 시작되면 남은 단계 생략 (종료 제한 시간 내 완료)
+        if (m_processShutdown.IsCancelled()) {
+            return;
+        }
+        UpdateEngagementPlanResult();
+        if (m_processShutdown.IsCancelled()) {
+            return;
+        }
+        SendEngagementPlanResult();
+        AdaptPlanCycleRate();
     }
 
-    void EngagementManagerBase::UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) {
-        {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            m_ownShipInfo = ownShip;
+    void EngagementManagerBase::TakeEnvironmentSnapshot() {
+        m_cycleInputs.waypointsVersion = m_waypointInput.Version();
+        RefreshOwnShipInput();
+        m_cycleInputs.target = m_targetInput.Load();
+        m_cycleInputs.paInfo = m_paInput.Load();
+        m_cycleInputs.waypoints = m_waypointInput.Load();
+        m_cycleInputs.config = m_config.Load();
+    }
+
+    void EngagementManagerBase::RefreshOwnShipInput() {
+        // 게시 번호를 먼저 읽어 두면 이후 게시분은 다음 판단에서 반영됨
+        uint64_t version = m_ownShipInput.Version();
+        m_cycleInputs.ownShip = m_ownShipInput.Load();
+        if (m_processedOwnShipVersion.exchange(version) != version) {
+            ++m_ownShipProcessed;
         }
-        IsInValidLaunchGeometry();
-        DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " ownship info updated" << std::endl;
     }
 
-    void EngagementManagerBase::UpdateSystemTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) {
-        {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            m_targetInfo = target;
+    // 산출 주기 사이 최신 항법 정보로 발사 가능 구역만 판단 (산출 작업, 발사 전)
+    void EngagementManagerBase::EvaluateLaunchGeometry() {
+        if (m_isLaunched.load() || !IsAssignmentBound()) {
+            return;
+        }
+
+        auto previous = m_cycleInputs.ownShip;
+        RefreshOwnShipInput();
+
+        // 판단 간 위치가 크게 바뀌면 (위치 보정 등) 즉시 재계획
+        bool jumped = ApproximateDistance_m(
+            previous->stShipMovementInfo().dShipLatitude(), previous->stShipMovementInfo().dShipLongitude(),
+            m_cycleInputs.ownShip->stShipMovementInfo().dShipLatitude(), m_cycleInputs.ownShip->stShipMovementInfo().dShipLongitude())
+            >= m_cycleInputs.config->GetWeaponSpec(m_weaponKind).ownshipJumpThreshold_m;
+        if (jumped) {
+            RequestImmediatePlanCycle("ownship position jump");
+            return;     // 구역 판단은 재계획 주기에서 수행
+        }
+
+        // 구역 진입/이탈 시 준비 상태가 늦지 않도록 즉시 재계획
+        bool inLaunchGeometry = IsInValidLaunchGeometry();
+        if (inLaunchGeometry != m_inLaunchGeometry) {
+            m_inLaunchGeometry = inLaunchGeometry;
+            RequestImmediatePlanCycle(inLaunchGeometry ? "entered launch geometry" : "left launch geometry");
+        }
+    }
+
+    void EngagementManagerBase::RequestImmediatePlanCycle(const char* reason) {
+        // 발사 후에는 주기 산출(위치 추정)만 수행, 입력 변경으로 추가 산출하지 않음
+        if (m_isLaunched.load()) {
+            return;
+        }
+
+        m_inputGeneration.fetch_add(1);
+        SubmitPlanCycle(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(m_planDeadline_sec.load())));
+
+        DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " immediate re-planning requested: " << reason << std::endl;
+    }
+
+    void EngagementManagerBase::AdaptPlanCycleRate() {
+        // 주기 시작 시 받은 설정 스냅샷 사용 (잠금 없음)
+        const WeaponSpecification& weaponSpec = m_cycleInputs.config->GetWeaponSpec(m_weaponKind);
+        double planningInterval_sec = weaponSpec.planIntervalPlanning_sec;
+        double readyInterval_sec = weaponSpec.planIntervalReady_sec;
+        double maxBackoff_sec = weaponSpec.planIntervalMaxBackoff_sec;
+        double jumpThreshold_m = weaponSpec.ownshipJumpThreshold_m;
+        double latitude = m_cycleInputs.ownShip->stShipMovementInfo().dShipLatitude();
+        double longitude = m_cycleInputs.ownShip->stShipMovementInfo().dShipLongitude();
+
+        PlanPhase phase = m_isLaunched.load() ? PlanPhase::PostLaunch
+            : (m_engagementPlanReady.load() ? PlanPhase::Ready : PlanPhase::Planning);
+
+        double interval_sec;
+        if (phase == PlanPhase::PostLaunch) {
+            // 발사 후에는 추정 주기를 바꾸지 않음 (적분은 실제 경과 시간 기준)
+            interval_sec = weaponSpec.engagementPlanUpdateInterval_sec;
+        }
+        else {
+            double phaseInterval_sec = (phase == PlanPhase::Ready) ? readyInterval_sec : planningInterval_sec;
+
+            // 입력(할당/경로점/표적/PA/설정) 변경 또는 자함의 유의미한 이동이 있었는지 확인
+            uint64_t generation = m_inputGeneration.load();
+            bool ownshipMoved = !m_hasPlannedOwnship
+                || ApproximateDistance_m(m_plannedOwnshipLatitude, m_plannedOwnshipLongitude, latitude, longitude) >= jumpThreshold_m;
+            if (ownshipMoved) {
+                m_hasPlannedOwnship = true;
+                m_plannedOwnshipLatitude = latitude;
+                m_plannedOwnshipLongitude = longitude;
+            }
+            bool inputsChanged = generation != m_plannedInputGeneration || ownshipMoved || phase != m_planPhase;
+            m_plannedInputGeneration = generation;
+
+            // 변화가 없으면 주기를 두 배씩 늘림 (최대 주기까지), 변화가 있으면 단계 기본 주기로 복귀
+            interval_sec = inputsChanged ? phaseInterval_sec
+                : std::min(std::max(m_planInterval_sec, phaseInterval_sec) * 2.0, std::max(maxBackoff_sec, phaseInterval_sec));
+        }
+        m_planPhase = phase;
+
+        if (interval_sec > 0.0 && interval_sec != m_planInterval_sec) {
+            m_planInterval_sec = interval_sec;
+            m_planDeadline_sec.store(interval_sec);
+            TimerService::GetInstance().SetPeriod(m_planTimerId,
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(interval_sec)));
+            DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " plan cycle interval: " << interval_sec << " sec" << std::endl;
         }
+    }
+
+    void EngagementManagerBase::UpdateOwnShipInfo(std::shared_ptr<const NAVINF_SHIP_NAVIGATION_INFO> ownShip) {
+        // 고빈도 수신: 최신 값만 교체 (위치 급변 확인과 발사 가능 구역 판단은 구역 판단 주기에 산출 작업에서 수행)
+        auto publishStart = std::chrono::steady_clock::now();
+        m_ownShipInput.Publish(std::move(ownShip));
+        m_ownShipReceived.fetch_add(1, std::memory_order_relaxed);
+        m_inputPublishLatency.Record(std::chrono::steady_clock::now() - publishStart);
+    }
+
+    void EngagementManagerBase::UpdateSystemTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) {
+        auto publishStart = std::chrono::steady_clock::now();
+        m_targetInput.Publish(target);
+        m_inputPublishLatency.Record(std::chrono::steady_clock::now() - publishStart);
+        m_inputGeneration.fetch_add(1);
         DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " system target info updated" << std::endl;
     }
 
     void EngagementManagerBase::UpdatePAInfo(const CMSHCI_AIEP_PA_INFO& paInfo) {
-        {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            m_paInfo = paInfo;
-        }
+        auto publishStart = std::chrono::steady_clock::now();
+        m_paInput.Publish(paInfo);
+        m_inputPublishLatency.Record(std::chrono::steady_clock::now() - publishStart);
+        m_inputGeneration.fetch_add(1);
         DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " PA info updated" << std::endl;
     }
 
     void EngagementManagerBase::UpdateWaypoints(const CMSHCI_AIEP_WPN_GEO_WAYPOINTS& waypoints) {
-        {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            m_waypointCmd = waypoints;
-        }
-        SetWaypoints();
+        // 경로점 반영(SetWaypoints)은 산출 작업에서 스냅샷 변경 시 수행
+        auto publishStart = std::chrono::steady_clock::now();
+        m_waypointInput.Publish(waypoints);
+        m_inputPublishLatency.Record(std::chrono::steady_clock::now() - publishStart);
 
         DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " waypoints updated" << std::endl;
+        RequestImmediatePlanCycle("new waypoints");
+    }
+
+    bool EngagementManagerBase::BindAssignment(const ST_WA_SESSION& weaponAssignInfo)
+    {
+        // 계획 적재까지 호출 스레드에서 수행하여 실패하면 할당 거부 (산출 시작 전이므로 산출 작업과 겹치지 않음)
+        // 부설계획은 메모리 저장소에서 읽으므로 파일 파싱 없음
+        if (m_assignmentBound.load() || !IsValidAssignmentInfo(weaponAssignInfo)) {
+            return false;
+        }
+
+        // 적재 중 수신된 계획 편집 통지도 반영되도록 먼저 연결 (실패 시 관리자는 폐기됨)
+        m_weaponAssignmentInfo = weaponAssignInfo;
+        m_assignmentBound.store(true);
+
+        if (!PrepareAssignment(weaponAssignInfo)) {
+            DEBUG_ERROR_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " failed to prepare assigned engagement plan" << std::endl;
+            return false;
+        }
+        return true;
     }
 
     bool EngagementManagerBase::UpdateWeaponAssignmentInformation(const ST_WA_SESSION weaponAssignInfo)
@@ -137,8 +455,10 @@ namespace AIEP {
         {
             if (IsAssignmentInfoChanged(weaponAssignInfo)) // 기존 할당 정보와 다른가?
             {
+                CancelFlows("weapon assignment changed");
                 ApplyWeaponAssignmentInformation(weaponAssignInfo);
                 m_weaponAssignmentInfo = weaponAssignInfo;
+                RequestImmediatePlanCycle("weapon assignment changed");
                 return true;
             }
         }
@@ -148,22 +468,117 @@ namespace AIEP {
 
     void EngagementManagerBase::RequestAIWaypointInference(const CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ& AIWPInferReq)
     {
-        AIEP_INTERNAL_INFER_REQ msg;
-        SetAIWaypointInferenceRequestMessage(msg);
-        m_ddsComm->Send(msg);
+        CancellationToken token;
+        if (!BeginFlow(token)) {
+            return;
+        }
+        StartDetached(AIWaypointInferenceFlow(token), [this](std::exception_ptr error) {
+            EndFlow("AI waypoint inference", error);
+            });
     }
 
     void EngagementManagerBase::ProcessAIInferredWaypoints(const AIEP_INTERNAL_INFER_RESULT_WP& AIWPInferReq)
     {
-        AIEP_AI_INFER_RESULT_WP msg;        
-        ConvertAIWaypointsToGeodetic(AIWPInferReq, msg);
-        m_ddsComm->Send(msg);
+        // 결과 변환/송신은 대기 중인 추론 흐름에서 수행
+        if (!m_inferenceResult.Deliver(AIWPInferReq)) {
+            DEBUG_WARNING_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " AI waypoint result dropped: no pending inference request" << std::endl;
+        }
+    }
+
+    Task<void> EngagementManagerBase::AIWaypointInferenceFlow(CancellationToken token)
+    {
+        // DDS 수신 스레드에서 분리하여 요청 메시지 구성
+        co_await ResumeOnPool{ std::chrono::steady_clock::now() };
+
+        AIEP_INTERNAL_INFER_REQ request;
+        SetAIWaypointInferenceRequestMessage(request);
+
+        // 응답 대기를 먼저 등록한 뒤 요청 송신 (빠른 응답 유실 방지)
+        double timeout_sec = m_config.Load()->businessLogic.aiInferenceTimeout_sec;
+        auto reply = m_inferenceResult.Wait(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(timeout_sec)), token);
+        m_ddsComm->Send(request);
+
+        auto result = co_await reply;
+        if (!result) {
+            if (token.IsCancelled()) {
+                DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " AI waypoint inference cancelled" << std::endl;
+            }
+            else {
+                DEBUG_WARNING_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " AI waypoint inference timed out or superseded ("
+                    << timeout_sec << " sec)" << std::endl;
+            }
+            co_return;
+        }
+
+        // Writer 송신 샘플을 대여하여 그 자리에서 변환 (이전 송신의 경로점은 변환 시 초기화)
+        auto msg = m_ddsComm->LoanSample<AIEP_AI_INFER_RESULT_WP>();
+        ConvertAIWaypointsToGeodetic(*result, *msg);
+        m_ddsComm->Send(std::move(msg));
+    }
+
+    bool EngagementManagerBase::BeginFlow(CancellationToken& token)
+    {
+        std::lock_guard<std::mutex> lock(m_flowMutex);
+        if (m_shutdown.load() || m_processShutdown.IsCancelled()) {
+            return false;
+        }
+        token = m_flowCancellation.Token();
+        ++m_activeFlows;
+        return true;
+    }
+
+    void EngagementManagerBase::EndFlow(const char* name, std::exception_ptr error)
+    {
+        if (error) {
+            try {
+                std::rethrow_exception(error);
+            }
+            catch (const std::exception& e) {
+                DEBUG_ERROR_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " " << name << " failed: " << e.what() << std::endl;
+            }
+            catch (...) {
+                DEBUG_ERROR_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " " << name << " failed" << std::endl;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_flowMutex);
+        --m_activeFlows;
+        m_flowsFinished.notify_all();
+    }
+
+    void EngagementManagerBase::CancelFlows(const char* reason)
+    {
+        CancellationSource cancelled;
+        {
+            std::lock_guard<std::mutex> lock(m_flowMutex);
+            std::swap(cancelled, m_flowCancellation);
+        }
+        cancelled.Cancel();     // 대기 중인 흐름은 공용 작업 풀에서 재개되어 종료
+        DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " pending flows cancelled: " << reason << std::endl;
     }
 
     void EngagementManagerBase::WeaponLaunched(std::chrono::steady_clock::time_point launchTime) {
+        m_launchTime = launchTime;     // 산출 작업이 m_isLaunched 확인 후 읽으므로 먼저 기록
         m_isLaunched.store(true);
-        m_launchTime = launchTime;
         EngagementPlanInitializationAfterLaunch();
         DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " weapon launched - switching to post-launch mode" << std::endl;
     }
+
+    void EngagementManagerBase::SetPlanReadinessListener(PlanReadinessListener listener) {
+        std::lock_guard<std::mutex> lock(m_readinessMutex);
+        m_planReadinessListener = listener;
+    }
+
+    void EngagementManagerBase::SetEngagementPlanReady(bool ready) {
+        if (m_engagementPlanReady.exchange(ready) == ready) {
+            return;
+        }
+
+        // 변경 시점에만 통지 (해제와 동시에 호출되지 않도록 잠금 상태에서 호출)
+        std::lock_guard<std::mutex> lock(m_readinessMutex);
+        if (m_planReadinessListener) {
+            m_planReadinessListener(ready);
+        }
+    }
 } // namespace AIEP
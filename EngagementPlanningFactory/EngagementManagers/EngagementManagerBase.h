@@ -3,10 +3,13 @@
 #include "IEngagementManager.h"
 #include "../../Common/Utils/ConfigManager.h"
 #include "../../Common/Utils/DebugPrint.h"
-#include <thread>
+#include "../../Common/Utils/SnapshotCell.h"
+#include "../../Common/Utils/LatencyRecorder.h"
+#include "../../Common/Utils/Coroutine.h"
 #include <atomic>
 #include <chrono>
 #include <mutex>
+#include <condition_variable>
 
 namespace AIEP {
 
@@ -16,20 +19,23 @@ namespace AIEP {
     class EngagementManagerBase : public IEngagementManager {
     public:
         EngagementManagerBase(ST_WA_SESSION weaponAssignInfo, std::shared_ptr<AIEP::DdsComm> ddsComm);
+        // 할당 전 사전 생성 (BindAssignment 로 할당 연결)
+        EngagementManagerBase(int tubeNumber, uint32_t weaponKind, std::shared_ptr<AIEP::DdsComm> ddsComm);
         virtual ~EngagementManagerBase();
 
         //bool Initialize(int tubeNumber, EN_WPN_KIND weaponKind) override;
         void Reset() override;
         void Shutdown() override;
         void StartEngagementPlanManager() override;
-        void WorkerLoop() override;
+        void RunPlanCycle() override;
 
         // DDS 메시지 처리 (LaunchTubeManager에서 직접 호출)
-        void UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) override;
+        void UpdateOwnShipInfo(std::shared_ptr<const NAVINF_SHIP_NAVIGATION_INFO> ownShip) override;
         void UpdateSystemTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) override;
         void UpdatePAInfo(const CMSHCI_AIEP_PA_INFO& paInfo) override;
         void UpdateWaypoints(const CMSHCI_AIEP_WPN_GEO_WAYPOINTS& waypoints) override;
         bool UpdateWeaponAssignmentInformation(const ST_WA_SESSION weaponAssignInfo) override;
+        bool BindAssignment(const ST_WA_SESSION& weaponAssignInfo) override;
         void RequestAIWaypointInference(const CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ& AIWPInferReq) override;
         void ProcessAIInferredWaypoints(const AIEP_INTERNAL_INFER_RESULT_WP& AIWPInferReq) override;
 
@@ -41,6 +47,9 @@ namespace AIEP {
             return m_engagementPlanReady.load();
         }
 
+        // 준비 상태 변경 통지 콜백 주입
+        void SetPlanReadinessListener(PlanReadinessListener listener) override;
+
         //template <typename T> //검토: 의존관계를 단순히 하기 위해 여기에 추가하거나, Weapon Control system에서만 Dds관련 클래스를 사용하는건 어떨지
         //void SendMessage(const T& message)
         //{
@@ -50,12 +59,29 @@ namespace AIEP {
     protected:
         void WeaponSpecInitialization() override;
 
+        // 준비 상태 갱신, 변경된 경우에만 통지
+        void SetEngagementPlanReady(bool ready);
+
+        // 입력 변경 시 다음 주기를 기다리지 않고 즉시 재계획 (주기는 단계 기본값으로 복귀)
+        void RequestImmediatePlanCycle(const char* reason);
+
+        // 산출 주기 시작 시점의 환경 정보 (한 주기 동안 일관된 값 사용)
+        struct EnvironmentSnapshot {
+            std::shared_ptr<const NAVINF_SHIP_NAVIGATION_INFO> ownShip;
+            std::shared_ptr<const TRKMGR_SYSTEMTARGET_INFO> target;
+            std::shared_ptr<const CMSHCI_AIEP_PA_INFO> paInfo;
+            std::shared_ptr<const CMSHCI_AIEP_WPN_GEO_WAYPOINTS> waypoints;
+            uint64_t waypointsVersion{ 0 };
+            std::shared_ptr<const ConfigSnapshot> config;
+        };
+        void TakeEnvironmentSnapshot();
+
         virtual void EngagementPlanInitializationAfterLaunch() = 0;
         virtual void UpdateEngagementPlanResult() = 0;
         virtual void SendEngagementPlanResult() = 0;
 
-        // 발사 가능 구역 진입 여부 확인
-        virtual void IsInValidLaunchGeometry() = 0;
+        // 발사 가능 구역 진입 여부 확인 (산출 작업에서만 호출, m_cycleInputs.ownShip 기준)
+        virtual bool IsInValidLaunchGeometry() = 0;
 
         // 무장별 경로점 설정
         virtual void SetWaypoints() = 0;
@@ -63,7 +89,7 @@ namespace AIEP {
         // AI 경로점 요청을 위한 명중지점 및 금지구역 정보 변환
         virtual void SetAIWaypointInferenceRequestMessage(AIEP_INTERNAL_INFER_REQ& RequestMsg) = 0;
 
-        //
+        // AI 경로점 추론 결과를 위경도로 변환 (msg 는 대여한 송신 샘플이므로 이전 송신 내용을 모두 덮어써야 함)
         virtual void ConvertAIWaypointsToGeodetic(const AIEP_INTERNAL_INFER_RESULT_WP& AIWPInferReq, AIEP_AI_INFER_RESULT_WP& msg) = 0;
 
         // 할당 정보 변경 여부 확인 및 반영
@@ -71,6 +97,13 @@ namespace AIEP {
         virtual bool IsAssignmentInfoChanged(const ST_WA_SESSION& weaponAssignInfo) = 0;
         virtual void ApplyWeaponAssignmentInformation(const ST_WA_SESSION weaponAssignInfo) = 0;
 
+        // 연결된 할당의 계획 적재 및 초기화 (BindAssignment 에서 호출, 실패하면 할당 거부)
+        virtual bool PrepareAssignment(const ST_WA_SESSION& weaponAssignInfo) { return true; }
+
+        // 새 설정 스냅샷 반영 (스냅샷이 바뀐 뒤 첫 산출 주기 시작 시 산출 작업에서 호출)
+        virtual void ApplyConfiguration(const ConfigSnapshot& config);
+        bool IsAssignmentBound() const { return m_assignmentBound.load(); }
+
         // 멤버 변수
         int m_tubeNumber;
         uint32_t m_weaponKind;
@@ -79,8 +112,20 @@ namespace AIEP {
         std::atomic<bool> m_shutdown{ false };
         std::atomic<bool> m_isLaunched{ false };
         std::atomic<bool> m_engagementPlanReady{ false };
-        std::thread m_engagementPlanThread;
-
+        std::atomic<bool> m_assignmentBound{ false };
+        PlanReadinessListener m_planReadinessListener;
+        std::mutex m_readinessMutex;
+
+        // 산출 주기 (TimerService 통지 시 공용 작업 풀에 산출 작업 제출)
+        int m_planTimerId{ -1 };
+        bool m_planCycleDue{ false };       // 산출 요청 있음 (m_cycleMutex 보호)
+        bool m_planCycleQueued{ false };    // 산출 작업 제출/실행 중, 관리자당 최대 1개 (m_cycleMutex 보호)
+        std::mutex m_cycleMutex;
+        std::condition_variable m_cycleCondition;   // 종료 시 실행 중인 산출 작업 완료 대기
+
+        // 설정 스냅샷 (생성 시 받아 두고 설정 변경 통지 시 교체, 산출 작업은 m_cycleInputs.config 사용)
+        SnapshotCell<ConfigSnapshot> m_config;
+        int m_configSubscriptionId{ -1 };   // StartEngagementPlanManager 에서 구독, Shutdown 에서 해제
         WeaponSpecification m_weaponSpec;
 
         // 할당 정보
@@ -89,12 +134,70 @@ namespace AIEP {
         // 발사 시간
         std::chrono::steady_clock::time_point m_launchTime;
 
-        // 환경 정보
-        NAVINF_SHIP_NAVIGATION_INFO m_ownShipInfo;
-        TRKMGR_SYSTEMTARGET_INFO m_targetInfo;
-        CMSHCI_AIEP_PA_INFO m_paInfo;
-        CMSHCI_AIEP_WPN_GEO_WAYPOINTS m_waypointCmd;
-
-        std::mutex m_dataMutex;
+        // 환경 정보 (DDS 수신 스레드가 잠금 없이 게시, 산출 작업은 m_cycleInputs 사용)
+        SnapshotCell<NAVINF_SHIP_NAVIGATION_INFO> m_ownShipInput;
+        SnapshotCell<TRKMGR_SYSTEMTARGET_INFO> m_targetInput;
+        SnapshotCell<CMSHCI_AIEP_PA_INFO> m_paInput;
+        SnapshotCell<CMSHCI_AIEP_WPN_GEO_WAYPOINTS> m_waypointInput;
+        EnvironmentSnapshot m_cycleInputs;
+
+        std::mutex m_dataMutex;     // 산출 결과 보호 (환경 정보 게시는 잠그지 않음)
+
+    private:
+        enum class PlanPhase { Planning, Ready, PostLaunch };
+
+        // 환경 정보 게시 소요 시간 (DDS 수신 스레드 점유 시간)
+        LatencyRecorder<256> m_inputPublishLatency;
+
+        // 단계와 입력 변화에 따라 다음 산출 주기 결정 (산출 작업에서만 호출)
+        void AdaptPlanCycleRate();
+
+        // 설정 변경 통지 (파일 감시 스레드, 이 무장 제원이나 교전계획 설정이 바뀐 경우에만 스냅샷 교체)
+        void OnConfigurationChanged(const ConfigChange& change);
+
+        // 산출 요청 (이미 제출된 작업이 있으면 그 작업이 한 주기 더 실행)
+        void SubmitPlanCycle(std::chrono::steady_clock::time_point deadline);
+        void RunPendingPlanCycles();
+
+        // 발사 가능 구역 판단 (주기마다 새 항법 정보가 있으면 산출 작업과 같은 직렬 실행으로 제출)
+        void SubmitGeometryEvaluation(std::chrono::steady_clock::time_point deadline);
+        void EvaluateLaunchGeometry();
+        void RefreshOwnShipInput();     // 최신 항법 정보를 m_cycleInputs 에 반영
+
+        int m_geometryTimerId{ -1 };
+        bool m_geometryDue{ false };                    // 구역 판단 요청 있음 (m_cycleMutex 보호)
+        std::atomic<double> m_geometryInterval_sec{ 1.0 };  // 구역 판단 주기 (판단 작업 마감)
+        bool m_inLaunchGeometry{ false };               // 산출 작업 전용, 마지막 판단 결과
+
+        // 항법 정보 수신/처리 수 (차이는 최신 값으로 합쳐져 판단하지 않은 표본)
+        std::atomic<uint64_t> m_ownShipReceived{ 0 };
+        std::atomic<uint64_t> m_processedOwnShipVersion{ 0 };  // 마지막으로 반영한 게시 번호
+        uint64_t m_ownShipProcessed{ 0 };               // 산출 작업 전용
+
+        std::atomic<double> m_planDeadline_sec{ 1.0 };  // 산출 작업 마감 (현재 주기)
+        CancellationToken m_processShutdown;            // 프로세스 종료 시작 시 취소 (산출 단계 사이에서 확인)
+
+        // 비동기 흐름 (코루틴, 할당 변경/종료 시 취소)
+        bool BeginFlow(CancellationToken& token);
+        void EndFlow(const char* name, std::exception_ptr error);
+        void CancelFlows(const char* reason);
+
+        // AI 경로점 추론: 요청 송신 → 결과 대기 (시간 초과/취소) → 변환 및 송신
+        Task<void> AIWaypointInferenceFlow(CancellationToken token);
+
+        std::mutex m_flowMutex;
+        std::condition_variable m_flowsFinished;
+        CancellationSource m_flowCancellation;      // m_flowMutex 보호, 취소 시 새 소스로 교체
+        int m_activeFlows{ 0 };                     // m_flowMutex 보호
+        AsyncSlot<AIEP_INTERNAL_INFER_RESULT_WP> m_inferenceResult;
+
+        std::atomic<uint64_t> m_inputGeneration{ 0 };  // 계획 입력 변경 시 증가
+        // 아래는 산출 작업 전용 상태 (한 번에 하나의 작업만 실행)
+        uint64_t m_plannedInputGeneration{ 0 };
+        PlanPhase m_planPhase{ PlanPhase::Planning };
+        double m_planInterval_sec{ 0.0 };
+        bool m_hasPlannedOwnship{ false };
+        double m_plannedOwnshipLatitude{ 0.0 };
+        double m_plannedOwnshipLongitude{ 0.0 };
     };
 } // namespace AIEP
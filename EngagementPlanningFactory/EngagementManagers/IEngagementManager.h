@@ -14,19 +14,23 @@ namespace AIEP {
     // =============================================================================
     class IEngagementManager {
     public:
+        // 교전계획 준비 상태 변경 통지 콜백 (공용 작업 풀의 교전계획 산출 작업에서 호출)
+        using PlanReadinessListener = std::function<void(bool ready)>;
+
         virtual ~IEngagementManager() = default;
 
         virtual void Reset() = 0;
         virtual void Shutdown() = 0;
         virtual void StartEngagementPlanManager() = 0;
-        virtual void WorkerLoop() = 0;  // 주기적 교전계획 산출
+        virtual void RunPlanCycle() = 0;  // 교전계획 1주기 산출 (공용 작업 풀에서 실행)
 
         // LaunchTubeManager에서 직접 호출 (DDS 메시지 처리)
-        virtual void UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) = 0;
+        virtual void UpdateOwnShipInfo(std::shared_ptr<const NAVINF_SHIP_NAVIGATION_INFO> ownShip) = 0;
         virtual void UpdateSystemTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) = 0;
         virtual void UpdatePAInfo(const CMSHCI_AIEP_PA_INFO& paInfo) = 0;
         virtual void UpdateWaypoints(const CMSHCI_AIEP_WPN_GEO_WAYPOINTS& waypoints) = 0;
         virtual bool UpdateWeaponAssignmentInformation(const ST_WA_SESSION weaponAssignInfo) = 0;
+        virtual bool BindAssignment(const ST_WA_SESSION& weaponAssignInfo) = 0;  // 사전 생성된 관리자에 할당 연결 및 계획 적재 (실패 시 false)
         virtual void RequestAIWaypointInference(const CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ& AIWPInferReq) = 0;
         virtual void ProcessAIInferredWaypoints(const AIEP_INTERNAL_INFER_RESULT_WP& AIWPInferReq) = 0;
         // ==========================================================================
@@ -36,9 +40,12 @@ namespace AIEP {
         // LaunchTubeManager가 발사 완료 알림을 전달
         virtual void WeaponLaunched(std::chrono::steady_clock::time_point launchTime) = 0;
 
-        // WpnStatusCtrlManager의 콜백에서 호출됨 (교전계획 준비 상태 확인)
+        // 교전계획 준비 상태 확인
         virtual bool IsEngagementPlanReady() const = 0;
 
+        // LaunchTubeManager가 준비 상태 변경 통지 콜백을 주입 (nullptr 이면 해제)
+        virtual void SetPlanReadinessListener(PlanReadinessListener listener) = 0;
+
     protected:
         virtual void WeaponSpecInitialization() = 0;
     };
@@ -1,92 +1,78 @@
 #include "M_MINE_DroppingPlanManager.h"
+#include "../M_MINE_Model/M_MINE_PlanValidator.h"
+#include "../../../../Common/Utils/DebugPrint.h"
+#include "../../../../Common/Utils/WorkStealingPool.h"
+#include <chrono>
+#include <filesystem>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
 namespace AIEP {
+	namespace {
+		// 발사관 프로세스 간 부설계획 파일 읽기-수정-기록 직렬화 (flock)
+		// 파일은 임시 파일 교체로 기록되어 inode 가 바뀌므로 별도의 잠금 파일을 사용
+		class PlanFileLock
+		{
+		public:
+			explicit PlanFileLock(const std::string& filename)
+			{
+				m_fd = ::open((filename + ".lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0664);
+				if (m_fd < 0) {
+					std::cerr << "Error opening plan lock file: " << filename << ".lock (" << std::strerror(errno) << ")" << std::endl;
+					return;
+				}
+				int result;
+				do {
+					result = ::flock(m_fd, LOCK_EX);
+				} while (result != 0 && errno == EINTR);
+				if (result != 0) {
+					std::cerr << "Error locking plan file: " << filename << " (" << std::strerror(errno) << ")" << std::endl;
+					::close(m_fd);
+					m_fd = -1;
+				}
+			}
+			~PlanFileLock()
+			{
+				if (m_fd >= 0) {
+					::flock(m_fd, LOCK_UN);
+					::close(m_fd);
+				}
+			}
+			PlanFileLock(const PlanFileLock&) = delete;
+			PlanFileLock& operator=(const PlanFileLock&) = delete;
+
+			bool IsLocked() const { return m_fd >= 0; }
+
+		private:
+			int m_fd{ -1 };
+		};
+	}
+
+	M_MineDroppingPlanManager& M_MineDroppingPlanManager::GetInstance()
+	{
+		static M_MineDroppingPlanManager instance;
+		return instance;
+	}
+
 	// Helper: Convert ST_WEAPON_WAYPOINT  to JSON
 	json M_MineDroppingPlanManager::pointToJson(const ST_WEAPON_WAYPOINT& pt)
 	{
-		json j;
-		j["dLatitude"] = pt.dLatitude();
-		j["dLongitude"] = pt.dLongitude();
-		j["fDepth"] = pt.fDepth();
-		j["fSpeed"] = pt.fSpeed();
-		j["bValid"] = pt.bValid();
-		return j;
+		return PlanCodec::ToJson(pt);
 	}
 
 	// Helper: Convert ST_M_MINE_PLAN_OWNSHIP_WAYPOINT to JSON
 	json M_MineDroppingPlanManager::waypointToJson(const ST_M_MINE_PLAN_OWNSHIP_WAYPOINT& wpt)
 	{
-		json j;
-		j["dLatitude"] = wpt.dLatitude();
-		j["dLongitude"] = wpt.dLongitude();
-		j["fDepth"] = wpt.fDepth();
-		j["fSpeed"] = wpt.fSpeed();
-		j["fHeading"] = wpt.fHeading();
-		j["bLaunchPoint"] = wpt.bLaunchPoint();
-		j["usListID"] = wpt.usListID();
-		return j;
+		return PlanCodec::ToJson(wpt);
 	}
 
+	// 15개 목록 x 15개 부설계획이 모두 0인 JSON 구조
 	json M_MineDroppingPlanManager::createEmptyPlanJson()
 	{
-		json j;
-		// stMsgHeader 처리: 여기서는 빈 객체로 처리 (필요하면 필드 추가)
-		j["stMsgHeader"] = json::object();
-		j["usPlanListCnt"] = 0;
-		j["stMinePlanList"] = json::array();
-
-		json jEmptyMinePoint;
-		jEmptyMinePoint["dLatitude"] = 0;
-		jEmptyMinePoint["dLongitude"] = 0;
-		jEmptyMinePoint["fDepth"] = 0.;
-		jEmptyMinePoint["fSpeed"] = 0.;
-		jEmptyMinePoint["bValid"] = 0.;
-
-		json jEmptyOwnshipPoint;
-		jEmptyOwnshipPoint["dLatitude"] = 0;
-		jEmptyOwnshipPoint["dLongitude"] = 0;
-		jEmptyOwnshipPoint["fDepth"] = 0.;
-		jEmptyOwnshipPoint["fSpeed"] = 0.;
-		jEmptyOwnshipPoint["fHeading"] = 0.;
-		jEmptyOwnshipPoint["bLaunchPoint"] = 0;
-		jEmptyOwnshipPoint["usListID"] = 0;
-
-		// 배열의 전체 슬롯은 15개로 고정
-		for (int i = 0; i < 15; i++) {
-			json jPlan;
-
-			jPlan["chDescription"] = "";
-			jPlan["sListID"] = 0;
-			jPlan["usOwnshipWaypointCnt"] = 0;
-
-			// 하위 부설계획 (최대 15개)
-			jPlan["stPlan"] = json::array();
-			for (int j = 0; j < 15; j++) {
-				json jInfo;
-
-				jInfo["sListID"] = 0;
-				jInfo["usDroppingPlanNumber"] = 0;
-				jInfo["ePlanState"] = 0;
-				jInfo["usWeaponID"] = 0;
-				jInfo["cAdditionalText"] = "";
-				// stDropPos, stLaunchPos
-				jInfo["stDropPos"] = jEmptyMinePoint;
-				jInfo["stLaunchPos"] = jEmptyMinePoint;
-				jInfo["usWaypointCnt"] = 0;
-				// stWaypoint: 배열 8개
-				jInfo["stWaypoint"] = json::array();
-				for (int k = 0; k < 8; k++) {
-					jInfo["stWaypoint"].push_back(jEmptyMinePoint);
-				}
-				jPlan["stPlan"].push_back(jInfo);
-			}
-			// 자함 변침점 (Ownship Waypoint): 배열 40개
-			jPlan["stOwnshipWaypoint"] = json::array();
-			for (int j = 0; j < 40; j++) {
-				jPlan["stOwnshipWaypoint"].push_back(jEmptyOwnshipPoint);
-			}
-			j["stMinePlanList"].push_back(jPlan);
-		}
-		return j;
+		auto emptyPlan = std::make_unique<CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST>();
+		return PlanCodec::ToJson(*emptyPlan);
 	}
 
 	/**
@@ -119,478 +105,118 @@ namespace AIEP {
 	{
 		std::ifstream infile(filename);
 		if (!infile.good()) { // 파일이 존재하지 않으면
-			json empty_json = createEmptyPlanJson(); // 빈 JSON 구조
-			std::ofstream outfile(filename);
-			outfile << empty_json.dump(4); // 들여쓰기 4칸
-			outfile.close();
+			auto emptyPlan = std::make_unique<CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST>(); // 빈 부설계획 구조
+			std::string buffer;
+			PlanCodec::Write(buffer, *emptyPlan);
+			writePlanFile(filename, buffer);
 			std::cout << "Created empty mine plan file: " << filename << std::endl;
 		}
 	}
 
+	// Helper: Convert ST_M_MINE_PLAN_INFO to JSON
+	json M_MineDroppingPlanManager::planInfoToJson(const ST_M_MINE_PLAN_INFO& info)
+	{
+		return PlanCodec::ToJson(info);
+	}
+
 	// DDS 메시지를 JSON 객체로 변환하는 함수
 	json M_MineDroppingPlanManager::ddsMessageToJson(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& msg) {
-		json j;
-		// stMsgHeader 처리: 여기서는 빈 객체로 처리 (필요하면 필드 추가)
-		j["stMsgHeader"] = json::object();
-		j["usPlanListCnt"] = msg.usPlanListCnt();
-		j["stMinePlanList"] = json::array();
-
-		// 배열의 전체 슬롯은 15개로 고정
-		for (int i = 0; i < 15; i++) {
-			json jPlan;
-			const ST_M_MINE_PLAN_LIST& plan = msg.stMinePlanList()[i];
-			jPlan["chDescription"] = plan.chDescription();
-			jPlan["sListID"] = plan.sListID();
-			jPlan["usOwnshipWaypointCnt"] = plan.usOwnshipWaypointCnt();
-
-			// 하위 부설계획 (최대 15개)
-			jPlan["stPlan"] = json::array();
-			for (int j = 0; j < 15; j++) {
-				json jInfo;
-				const ST_M_MINE_PLAN_INFO& info = plan.stPlan()[j];
-				jInfo["sListID"] = info.sListID();
-				jInfo["usDroppingPlanNumber"] = info.usDroppingPlanNumber();
-				jInfo["ePlanState"] = info.ePlanState();
-				jInfo["usWeaponID"] = info.usWeaponID();
-				jInfo["cAdditionalText"] = info.cAdditionalText();
-				// stDropPos, stLaunchPos
-				jInfo["stDropPos"] = pointToJson(info.stDropPos());
-				jInfo["stLaunchPos"] = pointToJson(info.stLaunchPos());
-				jInfo["usWaypointCnt"] = info.usWaypointCnt();
-				// stWaypoint: 배열 8개
-				jInfo["stWaypoint"] = json::array();
-				for (int k = 0; k < 8; k++) {
-					jInfo["stWaypoint"].push_back(pointToJson(info.stWaypoint()[k]));
-				}
-				jPlan["stPlan"].push_back(jInfo);
-			}
-			// 자함 변침점 (Ownship Waypoint): 배열 40개
-			jPlan["stOwnshipWaypoint"] = json::array();
-			for (int j = 0; j < 40; j++) {
-				jPlan["stOwnshipWaypoint"].push_back(waypointToJson(plan.stOwnshipWaypoint()[j]));
-			}
-			j["stMinePlanList"].push_back(jPlan);
-		}
-		return j;
+		return PlanCodec::ToJson(msg);
 	}
 
 	// 파일에 DDS 메시지를 JSON으로 저장하는 함수
 	bool M_MineDroppingPlanManager::saveDDSMessageToJsonFile(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& msg, const std::string& filename) {
-		json j = ddsMessageToJson(msg);
-		std::ofstream ofs(filename);
-		if (!ofs.is_open()) {
-			std::cerr << "Error opening file for writing: " << filename << std::endl;
+		std::string buffer;
+		PlanCodec::Write(buffer, msg);
+		if (!writePlanFile(filename, buffer)) {
 			return false;
 		}
-		ofs << j.dump(4);
-		ofs.close();
 		std::cout << "DDS message saved successfully to " << filename << std::endl;
 		return true;
 	}
 
-	// JSON 객체를 DDS 메시지로 복원
-	void M_MineDroppingPlanManager::jsonToDdsMessage(const json& j, AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST& msg)
+	// 파일 전체를 한 번에 읽어 DDS 메시지로 직접 역직렬화 (중간 json DOM 없음)
+	template <typename T>
+	bool M_MineDroppingPlanManager::readPlanFile(const std::string& filename, T& msg)
 	{
-		// --- 1) Top?level count ---
-		unsigned short cnt = j.value("usPlanListCnt", 0u);
-		msg.usPlanListCnt(cnt);
-
-		// --- 2) Plan List 배열 복원 ---
-		auto const& jPlanList = j.value("stMinePlanList", json::array());
-		size_t planCount = std::min<size_t>(jPlanList.size(), 15);
-
-		for (size_t i = 0; i < planCount; ++i)
-		{
-			const auto& jPlan = jPlanList[i];
-			auto& plan = msg.stMinePlanList()[i];
-
-			// 2.1) chDescription (50바이트 char[])
-			{
-				std::string desc;
-				// chDescription가 배열인지 확인합니다.
-				if (jPlan["chDescription"].is_array()) {
-					// 배열의 각 정수를 문자로 변환하고, null(0)이 나오면 종료합니다.
-					for (const auto& ch : jPlan["chDescription"]) {
-						int c = ch.get<int>();
-						if (c == 0) break;
-						desc.push_back(static_cast<char>(c));
-					}
-				}
-				else {
-					// 만약 문자열이면 바로 읽습니다.
-					desc = jPlan.value("chDescription", "");
-				}
-
-				char a[50];
-				std::strncpy(a, desc.c_str(), sizeof(plan.chDescription()));
-				for (int i = 0; i < 50; i++)
-				{
-					plan.chDescription()[i] = a[i];//static_cast<dds::core::array< char, 50L>> (*a);
-				}
-				plan.chDescription()[sizeof(plan.chDescription()) - 1] = '\0';
-			}
-
-			// 2.2) sListID
-			plan.sListID(jPlan.value("sListID", 0));
-
-			// --- 3) 하위 부설계획(ST_M_MINE_PLAN_INFO) 복원 ---
-			auto const& jSubplans = jPlan.value("stPlan", json::array());
-			size_t subplanCount = std::min<size_t>(jSubplans.size(), 15);
-			for (size_t j = 0; j < subplanCount; ++j)
-			{
-				const auto& jInfo = jSubplans[j];
-				auto& info = plan.stPlan()[j];
-
-				info.sListID(jInfo.value("sListID", 0));
-				info.usDroppingPlanNumber(jInfo.value("usDroppingPlanNumber", 0u));
-				info.ePlanState(static_cast<uint32_t>(jInfo.value("ePlanState", 0)));
-				info.usWeaponID(jInfo.value("usWeaponID", 0u));
-
-				// 3.1) cAdditionalText (50바이트 char[])
-				{
-					std::string addText;
-					// cAdditionalText가 배열인지 확인합니다.
-					if (jInfo["cAdditionalText"].is_array()) {
-						// 배열의 각 정수를 문자로 변환하고, null(0)이 나오면 종료합니다.
-						for (const auto& ch : jInfo["cAdditionalText"]) {
-							int c = ch.get<int>();
-							if (c == 0) break;
-							addText.push_back(static_cast<char>(c));
-						}
-					}
-					else {
-						// 만약 문자열이면 바로 읽습니다.
-						addText = jInfo.value("cAdditionalText", "");
-					}
-
-					char a[50];
-					std::strncpy(a, addText.c_str(), sizeof(info.cAdditionalText()));
-					for (int i = 0; i < 50; i++)
-					{
-						info.cAdditionalText()[i] = a[i];//static_cast<dds::core::array< char, 50L>> (*a);
-					}
-					info.cAdditionalText()[sizeof(info.cAdditionalText()) - 1] = '\0';
-				}
-				if (jInfo.contains("stDropPos")) {
-					auto const& jd = jInfo["stDropPos"];
-					info.stDropPos().dLatitude() = jd.value("dLatitude", 0.0);
-					info.stDropPos().dLongitude() = jd.value("dLongitude", 0.0);
-					info.stDropPos().fDepth() = jd.value("fDepth", 0.0f);
-					info.stDropPos().fSpeed() = jd.value("fSpeed", 0.0f);
-					info.stDropPos().bValid() = jd.value("bValid", 0u);
-				}
-
-				// 3.3) stLaunchPos (ST_WEAPON_WAYPOINT )
-				if (jInfo.contains("stLaunchPos")) {
-					auto const& jl = jInfo["stLaunchPos"];
-					info.stLaunchPos().dLatitude() = jl.value("dLatitude", 0.0);
-					info.stLaunchPos().dLongitude() = jl.value("dLongitude", 0.0);
-					info.stLaunchPos().fDepth() = jl.value("fDepth", 0.0f);
-					info.stLaunchPos().fSpeed() = jl.value("fSpeed", 0.0f);
-					info.stLaunchPos().bValid() = jl.value("bValid", 0u);
-				}
-
-				// 3.4) usWaypointCnt
-				info.usWaypointCnt(jInfo.value("usWaypointCnt", 0u));
-
-				// 3.5) stWaypoint[8]
-				{
-					auto const& jw = jInfo.value("stWaypoint", json::array());
-					size_t wpCount = std::min<size_t>(jw.size(), 8);
-					for (size_t k = 0; k < wpCount; ++k) {
-						auto const& wj = jw[k];
-						auto& wpt = info.stWaypoint()[k];
-						wpt.dLatitude() = wj.value("dLatitude", 0.0);
-						wpt.dLongitude() = wj.value("dLongitude", 0.0);
-						wpt.fDepth() = wj.value("fDepth", 0.0f);
-						wpt.fSpeed() = wj.value("fSpeed", 0.0f);
-						wpt.bValid() = wj.value("bValid", 0u);
-					}
-					// 남은 슬롯은 0으로 초기화
-					for (size_t k = wpCount; k < 8; ++k) {
-						std::memset(&info.stWaypoint()[k], 0, sizeof(ST_WEAPON_WAYPOINT));
-					}
-				}
-			}
-
-			// 3.6) 남은 ST_M_MINE_PLAN_INFO 슬롯 초기화
-			for (size_t j = subplanCount; j < 15; ++j) {
-				std::memset(&plan.stPlan()[j], 0, sizeof(ST_M_MINE_PLAN_INFO));
-			}
+		std::ifstream ifs(filename, std::ios::binary);
+		if (!ifs.is_open()) {
+			std::cerr << "Error opening file for reading: " << filename << std::endl;
+			return false;
+		}
 
-			// --- 4) 자함 변침점 (OWNSHIP_WAYPOINT) 복원 ---
-			plan.usOwnshipWaypointCnt(jPlan.value("usOwnshipWaypointCnt", 0u));
+		std::string buffer;
+		ifs.seekg(0, std::ios::end);
+		buffer.resize(static_cast<size_t>(std::max<std::streamoff>(ifs.tellg(), 0)));
+		ifs.seekg(0, std::ios::beg);
+		ifs.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 
-			auto const& jOwn = jPlan.value("stOwnshipWaypoint", json::array());
-			size_t ownCount = std::min<size_t>(jOwn.size(), 40);
-			for (size_t k = 0; k < ownCount; ++k) {
-				auto const& oj = jOwn[k];
-				auto& ow = plan.stOwnshipWaypoint()[k];
-				ow.dLatitude() = oj.value("dLatitude", 0.0);
-				ow.dLongitude() = oj.value("dLongitude", 0.0);
-				ow.fDepth() = oj.value("fDepth", 0.0f);
-				ow.fSpeed() = oj.value("fSpeed", 0.0f);
-				ow.fHeading() = oj.value("fHeading", 0.0f);
-				ow.bLaunchPoint() = oj.value("bLaunchPoint", 0u);
-				ow.usListID() = oj.value("usListID", 0u);
-			}
-			for (size_t k = ownCount; k < 40; ++k) {
-				std::memset(&plan.stOwnshipWaypoint()[k], 0, sizeof(ST_M_MINE_PLAN_OWNSHIP_WAYPOINT));
-			}
+		if (!PlanCodec::Read(buffer, msg)) {
+			std::cerr << "Error parsing JSON file: " << filename << std::endl;
+			return false;
 		}
+		return true;
+	}
 
-		// --- 5) 남은 PlanList 슬롯 초기화 ---
-		for (size_t i = planCount; i < 15; ++i) {
-			std::memset(&msg.stMinePlanList()[i], 0, sizeof(ST_M_MINE_PLAN_LIST));
+	bool M_MineDroppingPlanManager::writePlanFile(const std::string& filename, const std::string& buffer)
+	{
+		std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+		if (!ofs.is_open()) {
+			std::cerr << "Error opening file for writing: " << filename << std::endl;
+			return false;
 		}
+		ofs.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		return ofs.good();
+	}
+
+	// JSON 객체를 DDS 메시지로 복원 (없는 필드와 남은 슬롯은 0)
+	void M_MineDroppingPlanManager::jsonToDdsMessage(const json& j, AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST& msg)
+	{
+		PlanCodec::FromJsonMessage(j, msg);
 	}
 
 	// JSON 객체를 DDS 메시지로 복원
 	void M_MineDroppingPlanManager::jsonToDdsMessage(const json& j, CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& msg)
 	{
-		// --- 1) Top?level count ---
-		unsigned short cnt = j.value("usPlanListCnt", 0u);
-		msg.usPlanListCnt(cnt);
-
-		// --- 2) Plan List 배열 복원 ---
-		auto const& jPlanList = j.value("stMinePlanList", json::array());
-		size_t planCount = std::min<size_t>(jPlanList.size(), 15);
-
-		for (size_t i = 0; i < planCount; ++i)
-		{
-			const auto& jPlan = jPlanList[i];
-			auto& plan = msg.stMinePlanList()[i];
-
-			// 2.1) chDescription (50바이트 char[])
-			{
-				std::string desc;
-				// chDescription가 배열인지 확인합니다.
-				if (jPlan["chDescription"].is_array()) {
-					// 배열의 각 정수를 문자로 변환하고, null(0)이 나오면 종료합니다.
-					for (const auto& ch : jPlan["chDescription"]) {
-						int c = ch.get<int>();
-						if (c == 0) break;
-						desc.push_back(static_cast<char>(c));
-					}
-				}
-				else {
-					// 만약 문자열이면 바로 읽습니다.
-					desc = jPlan.value("chDescription", "");
-				}
-
-				char a[50];
-				std::strncpy(a, desc.c_str(), sizeof(plan.chDescription()));
-				for (int i = 0; i < 50; i++)
-				{
-					plan.chDescription()[i] = a[i];//static_cast<dds::core::array< char, 50L>> (*a);
-				}
-				plan.chDescription()[sizeof(plan.chDescription()) - 1] = '\0';
-			}
-
-			// 2.2) sListID
-			plan.sListID(jPlan.value("sListID", 0));
-
-			// --- 3) 하위 부설계획(ST_M_MINE_PLAN_INFO) 복원 ---
-			auto const& jSubplans = jPlan.value("stPlan", json::array());
-			size_t subplanCount = std::min<size_t>(jSubplans.size(), 15);
-			for (size_t j = 0; j < subplanCount; ++j)
-			{
-				const auto& jInfo = jSubplans[j];
-				auto& info = plan.stPlan()[j];
-
-				info.sListID(jInfo.value("sListID", 0));
-				info.usDroppingPlanNumber(jInfo.value("usDroppingPlanNumber", 0u));
-				info.ePlanState(static_cast<uint32_t>(jInfo.value("ePlanState", 0)));
-				info.usWeaponID(jInfo.value("usWeaponID", 0u));
-
-				// 3.1) cAdditionalText (50바이트 char[])
-				{
-					std::string addText;
-					// cAdditionalText가 배열인지 확인합니다.
-					if (jInfo["cAdditionalText"].is_array()) {
-						// 배열의 각 정수를 문자로 변환하고, null(0)이 나오면 종료합니다.
-						for (const auto& ch : jInfo["cAdditionalText"]) {
-							int c = ch.get<int>();
-							if (c == 0) break;
-							addText.push_back(static_cast<char>(c));
-						}
-					}
-					else {
-						// 만약 문자열이면 바로 읽습니다.
-						addText = jInfo.value("cAdditionalText", "");
-					}
-
-					char a[50];
-					std::strncpy(a, addText.c_str(), sizeof(info.cAdditionalText()));
-					for (int i = 0; i < 50; i++)
-					{
-						info.cAdditionalText()[i] = a[i];//static_cast<dds::core::array< char, 50L>> (*a);
-					}
-					info.cAdditionalText()[sizeof(info.cAdditionalText()) - 1] = '\0';
-				}
-
-				// 3.2) stDropPos (ST_WEAPON_WAYPOINT )
-				if (jInfo.contains("stDropPos")) {
-					auto const& jd = jInfo["stDropPos"];
-					info.stDropPos().dLatitude() = jd.value("dLatitude", 0.0);
-					info.stDropPos().dLongitude() = jd.value("dLongitude", 0.0);
-					info.stDropPos().fDepth() = jd.value("fDepth", 0.0f);
-					info.stDropPos().fSpeed() = jd.value("fSpeed", 0.0f);
-					info.stDropPos().bValid() = jd.value("bValid", 0u);
-				}
-
-				// 3.3) stLaunchPos (ST_WEAPON_WAYPOINT )
-				if (jInfo.contains("stLaunchPos")) {
-					auto const& jl = jInfo["stLaunchPos"];
-					info.stLaunchPos().dLatitude() = jl.value("dLatitude", 0.0);
-					info.stLaunchPos().dLongitude() = jl.value("dLongitude", 0.0);
-					info.stLaunchPos().fDepth() = jl.value("fDepth", 0.0f);
-					info.stLaunchPos().fSpeed() = jl.value("fSpeed", 0.0f);
-					info.stLaunchPos().bValid() = jl.value("bValid", 0u);
-				}
-
-				// 3.4) usWaypointCnt
-				info.usWaypointCnt(jInfo.value("usWaypointCnt", 0u));
-
-				// 3.5) stWaypoint[8]
-				{
-					auto const& jw = jInfo.value("stWaypoint", json::array());
-					size_t wpCount = std::min<size_t>(jw.size(), 8);
-					for (size_t k = 0; k < wpCount; ++k) {
-						auto const& wj = jw[k];
-						auto& wpt = info.stWaypoint()[k];
-						wpt.dLatitude() = wj.value("dLatitude", 0.0);
-						wpt.dLongitude() = wj.value("dLongitude", 0.0);
-						wpt.fDepth() = wj.value("fDepth", 0.0f);
-						wpt.fSpeed() = wj.value("fSpeed", 0.0f);
-						wpt.bValid() = wj.value("bValid", 0u);
-					}
-					// 남은 슬롯은 0으로 초기화
-					for (size_t k = wpCount; k < 8; ++k) {
-						std::memset(&info.stWaypoint()[k], 0, sizeof(ST_WEAPON_WAYPOINT));
-					}
-				}
-			}
-
-			// 3.6) 남은 ST_M_MINE_PLAN_INFO 슬롯 초기화
-			for (size_t j = subplanCount; j < 15; ++j) {
-				std::memset(&plan.stPlan()[j], 0, sizeof(ST_M_MINE_PLAN_INFO));
-			}
-
-			// --- 4) 자함 변침점 (OWNSHIP_WAYPOINT) 복원 ---
-			plan.usOwnshipWaypointCnt(jPlan.value("usOwnshipWaypointCnt", 0u));
-
-			auto const& jOwn = jPlan.value("stOwnshipWaypoint", json::array());
-			size_t ownCount = std::min<size_t>(jOwn.size(), 40);
-			for (size_t k = 0; k < ownCount; ++k) {
-				auto const& oj = jOwn[k];
-				auto& ow = plan.stOwnshipWaypoint()[k];
-				ow.dLatitude() = oj.value("dLatitude", 0.0);
-				ow.dLongitude() = oj.value("dLongitude", 0.0);
-				ow.fDepth() = oj.value("fDepth", 0.0f);
-				ow.fSpeed() = oj.value("fSpeed", 0.0f);
-				ow.fHeading() = oj.value("fHeading", 0.0f);
-				ow.bLaunchPoint() = oj.value("bLaunchPoint", 0u);
-				ow.usListID() = oj.value("usListID", 0u);
-			}
-			for (size_t k = ownCount; k < 40; ++k) {
-				std::memset(&plan.stOwnshipWaypoint()[k], 0, sizeof(ST_M_MINE_PLAN_OWNSHIP_WAYPOINT));
-			}
-		}
-
-		// --- 5) 남은 PlanList 슬롯 초기화 ---
-		for (size_t i = planCount; i < 15; ++i) {
-			std::memset(&msg.stMinePlanList()[i], 0, sizeof(ST_M_MINE_PLAN_LIST));
-		}
+		PlanCodec::FromJsonMessage(j, msg);
 	}
 	// 파일에서 DDS 메시지를 JSON 형식으로 읽어와 복원하는 함수
 	bool M_MineDroppingPlanManager::loadPlanFromFile(AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST& msg, const std::string& filename)
 	{
 		ensure_json_file_exists(filename);
-
-		std::ifstream ifs(filename);
-		if (!ifs.is_open()) {
-			std::cerr << "Error opening file for reading: " << filename << std::endl;
-			return false;
-		}
-
-		json j;
-		try {
-			ifs >> j;
-		}
-		catch (const std::exception& e) {
-			std::cerr << "Error parsing JSON file: " << e.what() << std::endl;
-			return false;
-		}
-		ifs.close();
-		jsonToDdsMessage(j, msg);
-		//std::cout << "Plan loaded successfully from " << filename << std::endl;
-		return true;
+		return readPlanFile(filename, msg);
 	}
 
 	// 파일에서 DDS 메시지를 JSON 형식으로 읽어와 복원하는 함수, 경로점만 수정하기 위한 오버로딩
 	bool M_MineDroppingPlanManager::loadPlanFromFile(CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& msg, const std::string& filename)
 	{
 		ensure_json_file_exists(filename);
-
-		std::ifstream ifs(filename);
-		if (!ifs.is_open()) {
-			std::cerr << "Error opening file for reading: " << filename << std::endl;
-			return false;
-		}
-
-		json j;
-		try {
-			ifs >> j;
-		}
-		catch (const std::exception& e) {
-			std::cerr << "Error parsing JSON file: " << e.what() << std::endl;
-			return false;
-		}
-		ifs.close();
-
-		jsonToDdsMessage(j, msg);
-		//std::cout << "Plan loaded successfully from " << filename << std::endl;
-		return true;
+		return readPlanFile(filename, msg);
 	}
 
 	// 파일에 DDS 메시지를 JSON 형식으로 저장하는 함수
 	bool M_MineDroppingPlanManager::savePlanToFile(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& msg, const std::string& filename) {
-		json j = ddsMessageToJson(msg);
-		std::ofstream ofs(filename);
-		if (!ofs.is_open()) {
-			std::cerr << "Error opening file for writing: " << filename << std::endl;
+		std::string buffer;
+		PlanCodec::Write(buffer, msg);
+		if (!writePlanFile(filename, buffer)) {
 			return false;
 		}
-		ofs << j.dump(4); // indent=4
-		ofs.close();
 		std::cout << "Plan saved successfully to " << filename << std::endl;
 		return true;
 	}
 	bool M_MineDroppingPlanManager::readDroppingPlanfromFile(const std::string& filename, int DroppingPlanListIdx, int DroppingPlanIdx, ST_M_MINE_PLAN_INFO& DropPlan)
 	{
-		ensure_json_file_exists(filename);
-
-		std::ifstream ifs(filename);
-		if (!ifs.is_open()) {
-			std::cerr << "Error opening file for reading: " << filename << std::endl;
+		if (!isValidPlanIndex(DroppingPlanListIdx, DroppingPlanIdx)) {
 			return false;
 		}
 
-		json j;
-		try {
-			ifs >> j;
-		}
-		catch (const std::exception& e) {
-			std::cerr << "Error parsing JSON file: " << e.what() << std::endl;
+		// 파일은 저장소 최초 로드 시에만 파싱
+		if (!loadPlanStore(filename)) {
 			return false;
 		}
-		ifs.close();
 
-		CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST msg;
-		jsonToDdsMessage(j, msg);
-		DropPlan = msg.stMinePlanList()[DroppingPlanListIdx].stPlan()[DroppingPlanIdx];
-		//std::cout << "Plan loaded successfully from " << filename << std::endl;
+		std::lock_guard<std::mutex> lock(m_storeMutex);
+		DropPlan = m_planStore.stMinePlanList()[DroppingPlanListIdx].stPlan()[DroppingPlanIdx];
 		return true;
 	}
 	bool M_MineDroppingPlanManager::readDropPosFromJson(
@@ -738,8 +364,85 @@ namespace AIEP {
 	bool M_MineDroppingPlanManager::updatePlanState(const std::string& filename,
 		int planListIndex,
 		int planIndex,
-		EN_M_MINE_PLAN_STATE newState) {
+		EN_M_MINE_PLAN_STATE newState,
+		int tubeNumber) {
 		// 1. 인덱스 유효성 검사
+		if (!isValidPlanIndex(planListIndex, planIndex)) {
+			return false;
+		}
+
+		// 2. 저장소 로드 (최초 1회만 파일 파싱)
+		if (!loadPlanStore(filename)) {
+			return false;
+		}
+
+		PlanStateEvent event{ tubeNumber, planListIndex, planIndex, EN_M_MINE_PLAN_STATE{}, newState };
+		std::vector<std::pair<int, int>> changedPlans;
+		std::vector<PlanStateEvent> stateEvents;
+		bool persisted{ true };
+		{
+			std::lock_guard<std::mutex> lock(m_storeMutex);
+
+			// 3. 다른 발사관 프로세스의 기록을 덮어쓰지 않도록 파일 잠금 후 최신 파일 내용을 먼저 반영
+			PlanFileLock fileLock(filename);
+			if (!fileLock.IsLocked()) {
+				return false;
+			}
+			if (!syncFromFileLocked(filename, changedPlans, stateEvents)) {
+				return false;
+			}
+
+			// 4. 이전 상태 기록
+			auto& info = m_planStore.stMinePlanList()[planListIndex].stPlan()[planIndex];
+			event.oldState = static_cast<EN_M_MINE_PLAN_STATE>(info.ePlanState());
+			if (event.oldState != newState) {
+				// 5. 해당 레코드의 상태만 변경 (해당 목록만 재직렬화)
+				info.ePlanState(static_cast<uint32_t>(newState));
+				m_persistDirtyLists.set(planListIndex);
+				m_publishDirtyLists.set(planListIndex);
+
+				// 6. 파일에 저장, 실패하면 메모리 상태를 되돌려 파일과 일치시킴 (전이 통지 없음)
+				persisted = persistPlanStore(filename);
+				if (persisted) {
+					stateEvents.push_back(event);
+				}
+				else {
+					info.ePlanState(static_cast<uint32_t>(event.oldState));
+					m_persistDirtyLists.set(planListIndex);
+				}
+			}
+		}
+
+		// 7. 파일에서 반영된 변경과 이번 전이를 구독자에게 통지
+		if (!changedPlans.empty()) {
+			validatePlans(changedPlans);
+			notifyPlanChanged(changedPlans);
+		}
+		notifyPlanStateChanged(stateEvents);
+		return persisted;
+	}
+
+	bool M_MineDroppingPlanManager::getPlanState(const std::string& filename,
+		int planListIndex,
+		int planIndex,
+		EN_M_MINE_PLAN_STATE& outState) {
+		// 인덱스 유효성 검사
+		if (!isValidPlanIndex(planListIndex, planIndex)) {
+			return false;
+		}
+
+		if (!loadPlanStore(filename)) {
+			return false;
+		}
+
+		// 상태 조회
+		std::lock_guard<std::mutex> lock(m_storeMutex);
+		outState = static_cast<EN_M_MINE_PLAN_STATE>(m_planStore.stMinePlanList()[planListIndex].stPlan()[planIndex].ePlanState());
+		return true;
+	}
+
+	bool M_MineDroppingPlanManager::isValidPlanIndex(int planListIndex, int planIndex) const
+	{
 		if (planListIndex < 0 || planListIndex >= 15) {
 			std::cerr << "Error: planListIndex " << planListIndex
 				<< " is out of range (0-14)" << std::endl;
@@ -751,139 +454,384 @@ namespace AIEP {
 				<< " is out of range (0-14)" << std::endl;
 			return false;
 		}
+		return true;
+	}
 
-		// 2. 파일이 존재하지 않으면 생성
-		ensure_json_file_exists(filename);
+	// ==========================================================================
+	// 메모리 내 부설계획 저장소
+	// ==========================================================================
+	bool M_MineDroppingPlanManager::loadPlanStore(const std::string& filename)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_storeMutex);
+			if (m_planStoreLoaded && m_planStoreFile == filename) {
+				return true;
+			}
 
-		try {
-			// 3. JSON 파일 읽기
-			std::ifstream ifs(filename);
-			if (!ifs.is_open()) {
-				std::cerr << "Error: Could not open file " << filename << std::endl;
+			// 빈 파일 생성과 최초 읽기도 다른 발사관 프로세스의 기록과 겹치지 않도록 파일 잠금 상태에서 수행
+			PlanFileLock fileLock(filename);
+			if (!fileLock.IsLocked()) {
 				return false;
 			}
+			ensure_json_file_exists(filename);
 
-			json j;
-			ifs >> j;
-			ifs.close();
-
-			// 4. JSON 구조 유효성 검사
-			if (!j.contains("stMinePlanList") || !j["stMinePlanList"].is_array()) {
-				std::cerr << "Error: Invalid JSON structure - missing stMinePlanList" << std::endl;
+			if (!readPlanFile(filename, m_planStore)) {
 				return false;
 			}
-			
-			if (j["stMinePlanList"].size() <= planListIndex) {
-				std::cerr << "Error: planListIndex " << planListIndex
-					<< " exceeds available plan lists" << std::endl;
-				return false;
+			m_persistDirtyLists.set(); // 최초 기록 시 모든 목록 직렬화
+			m_planStoreFile = filename;
+			m_planStoreLoaded = true;
+
+			// 최초 송신 시에는 전체 목록 송신
+			m_publishDirtyLists.set();
+			m_publishDirtyListCnt = true;
+		}
+
+		// 전체 부설계획 사전 검증은 공용 작업 풀에서 실행 (처음 저장소를 사용한 스레드를 붙잡지 않음, 완료 전 조회는 미검증으로 응답)
+		auto validateAll = [this]() {
+			std::vector<std::pair<int, int>> allPlans;
+			allPlans.reserve(15 * 15);
+			for (int i = 0; i < 15; i++) {
+				for (int j = 0; j < 15; j++) {
+					allPlans.emplace_back(i, j);
+				}
 			}
+			validatePlans(allPlans);
+		};
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1); // 산출 주기 작업보다 뒤로
+		if (!WorkStealingPool::GetInstance().Submit(validateAll, deadline)) {
+			validateAll(); // 작업 풀 정지 상태 (시작 전/종료 중)
+		}
+		return true;
+	}
+
+	bool M_MineDroppingPlanManager::applyEditedPlanList(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& msg, const std::string& filename)
+	{
+		if (!loadPlanStore(filename)) {
+			return false;
+		}
+
+		std::vector<std::pair<int, int>> changedPlans;
+		std::vector<PlanStateEvent> stateEvents;
+		bool persisted{ true };
+		{
+			std::lock_guard<std::mutex> lock(m_storeMutex);
 
-			auto& planList = j["stMinePlanList"][planListIndex];
-			if (!planList.contains("stPlan") || !planList["stPlan"].is_array()) {
-				std::cerr << "Error: Invalid plan list structure" << std::endl;
+			// 다른 발사관 프로세스가 기록한 상태 전이를 먼저 반영한 뒤 편집 내용을 덮어씀
+			PlanFileLock fileLock(filename);
+			if (!fileLock.IsLocked()) {
 				return false;
 			}
+			if (!syncFromFileLocked(filename, changedPlans, stateEvents)) {
+				// 읽을 수 없는 파일은 편집 결과를 포함한 메모리 저장소로 다시 기록됨
+				std::cerr << "Overwriting unreadable plan file with current plans: " << filename << std::endl;
+			}
 
-			if (planList["stPlan"].size() <= planIndex) {
-				std::cerr << "Error: planIndex " << planIndex
-					<< " exceeds available plans in list" << std::endl;
-				return false;
+			// 편집은 메모리에 반영된 상태로 유지하고 통지, 파일 기록 실패 시 다음 기록에서 전체 캐시로 다시 기록됨
+			if (mergePlanListLocked(msg, changedPlans, stateEvents)) {
+				persisted = persistPlanStore(filename);
 			}
+		}
 
-			// 5. 이전 상태 기록 (디버깅용)
-			EN_M_MINE_PLAN_STATE oldState =
-				static_cast<EN_M_MINE_PLAN_STATE>(planList["stPlan"][planIndex]["ePlanState"].get<int>());
+		if (!changedPlans.empty()) {
+			validatePlans(changedPlans);
+			notifyPlanChanged(changedPlans);
+		}
+		notifyPlanStateChanged(stateEvents);
+		return persisted;
+	}
 
-			// 6. 상태 변경
-			planList["stPlan"][planIndex]["ePlanState"] = static_cast<int>(newState);
+	// 외부(다른 발사관 프로세스, 편집기)에서 파일이 수정된 경우: 변경된 부설계획만 저장소에 반영 (파일 기록 없음)
+	bool M_MineDroppingPlanManager::reloadPlanStore(const std::string& filename)
+	{
+		std::vector<std::pair<int, int>> changedPlans;
+		std::vector<PlanStateEvent> stateEvents;
+		{
+			std::lock_guard<std::mutex> lock(m_storeMutex);
+			if (!m_planStoreLoaded || m_planStoreFile != filename) {
+				return true; // 아직 사용되지 않은 저장소는 최초 사용 시 로드됨
+			}
 
-			// 7. 파일에 저장
-			std::ofstream ofs(filename);
-			if (!ofs.is_open()) {
-				std::cerr << "Error: Could not open file for writing: " << filename << std::endl;
+			// 읽는 동안 자체 기록으로 저장소가 바뀌어 이전 내용으로 되돌리지 않도록 저장소 잠금도 유지
+			PlanFileLock fileLock(filename);
+			if (!fileLock.IsLocked() || !syncFromFileLocked(filename, changedPlans, stateEvents)) {
+				// 편집기가 기록 중인 파일일 수 있으므로 기존 저장소 유지
+				std::cerr << "Keeping current plans: " << filename << std::endl;
 				return false;
 			}
+		}
 
-			ofs << j.dump(4);
-			ofs.close();
-
-			// 8. 성공 로그
-			std::cout << "Plan state updated successfully:" << std::endl;
-			std::cout << "  File: " << filename << std::endl;
-			std::cout << "  Plan List[" << planListIndex << "] Plan[" << planIndex << "]" << std::endl;
-			std::cout << "  Old State: (" << static_cast<int>(oldState) << ")" << std::endl;
-			std::cout << "  New State: " << " (" << static_cast<int>(newState) << ")" << std::endl;
-
+		// 자체 기록(persistPlanStore)으로 인한 이벤트는 변경분이 없으므로 여기서 종료
+		if (changedPlans.empty() && stateEvents.empty()) {
 			return true;
 		}
-		catch (const json::exception& e) {
-			std::cerr << "JSON parsing error: " << e.what() << std::endl;
-			return false;
-		}
-		catch (const std::exception& e) {
-			std::cerr << "Error updating plan state: " << e.what() << std::endl;
-			return false;
-		}
+
+		DEBUG_STREAM(MINEMANAGER) << "Plan file reloaded: " << filename << " (" << changedPlans.size() << " changed records)" << std::endl;
+		validatePlans(changedPlans);
+		notifyPlanChanged(changedPlans);
+		notifyPlanStateChanged(stateEvents);
+		return true;
 	}
 
-	bool M_MineDroppingPlanManager::getPlanState(const std::string& filename,
-		int planListIndex,
-		int planIndex,
-		EN_M_MINE_PLAN_STATE& outState) {
-		// 인덱스 유효성 검사
-		if (planListIndex < 0 || planListIndex >= 15) {
-			std::cerr << "Error: planListIndex " << planListIndex
-				<< " is out of range (0-14)" << std::endl;
+	// 파일을 다시 읽어 다른 프로세스가 기록한 변경분만 저장소에 반영 (m_storeMutex 와 파일 잠금 보유 상태에서 호출)
+	bool M_MineDroppingPlanManager::syncFromFileLocked(const std::string& filename, std::vector<std::pair<int, int>>& changedPlans,
+		std::vector<PlanStateEvent>& stateEvents)
+	{
+		auto fileContents = std::make_unique<CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST>();
+		if (!readPlanFile(filename, *fileContents)) {
 			return false;
 		}
+		mergePlanListLocked(*fileContents, changedPlans, stateEvents);
+		return true;
+	}
 
-		
-		if (planIndex < 0 || planIndex >= 15) {
-			std::cerr << "Error: planIndex " << planIndex
-				<< " is out of range (0-14)" << std::endl;
-			return false;
+	bool M_MineDroppingPlanManager::mergePlanListLocked(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& msg, std::vector<std::pair<int, int>>& changedPlans,
+		std::vector<PlanStateEvent>& stateEvents)
+	{
+		bool listCntChanged{ false };
+
+		if (m_planStore.usPlanListCnt() != msg.usPlanListCnt()) {
+			m_planStore.usPlanListCnt(msg.usPlanListCnt());
+			m_publishDirtyListCnt = true;
+			listCntChanged = true;
 		}
 
-		try {
-			// JSON 파일 읽기
-			std::ifstream ifs(filename);
-			if (!ifs.is_open()) {
-				std::cerr << "Error: Could not open file " << filename << std::endl;
-				return false;
+		for (int i = 0; i < 15; i++) {
+			const ST_M_MINE_PLAN_LIST& edited = msg.stMinePlanList()[i];
+			ST_M_MINE_PLAN_LIST& stored = m_planStore.stMinePlanList()[i];
+			if (edited == stored) {
+				continue;
 			}
 
-			json j;
-			ifs >> j;
-			ifs.close();
+			// 목록 정보 (설명, 자함 변침점)
+			if (edited.chDescription() != stored.chDescription()
+				|| edited.sListID() != stored.sListID()
+				|| edited.usOwnshipWaypointCnt() != stored.usOwnshipWaypointCnt()
+				|| edited.stOwnshipWaypoint() != stored.stOwnshipWaypoint())
+			{
+				changedPlans.emplace_back(i, -1);
+			}
 
-			// JSON 구조 검증
-			if (!j.contains("stMinePlanList") || !j["stMinePlanList"].is_array() ||
-				j["stMinePlanList"].size() <= planListIndex) {
-				std::cerr << "Error: Invalid stMinePlanList or index out of range" << std::endl;
-				return false;
+			// 하위 부설계획
+			for (int j = 0; j < 15; j++) {
+				if (edited.stPlan()[j] != stored.stPlan()[j]) {
+					changedPlans.emplace_back(i, j);
+					if (edited.stPlan()[j].ePlanState() != stored.stPlan()[j].ePlanState()) {
+						stateEvents.push_back({ 0, i, j,
+							static_cast<EN_M_MINE_PLAN_STATE>(stored.stPlan()[j].ePlanState()),
+							static_cast<EN_M_MINE_PLAN_STATE>(edited.stPlan()[j].ePlanState()) });
+					}
+				}
 			}
 
-			auto& planList = j["stMinePlanList"][planListIndex];
-			if (!planList.contains("stPlan") || !planList["stPlan"].is_array() ||
-				planList["stPlan"].size() <= planIndex) {
-				std::cerr << "Error: Invalid stPlan or index out of range" << std::endl;
+			stored = edited;
+			m_publishDirtyLists.set(i);
+			m_persistDirtyLists.set(i);
+		}
+
+		return listCntChanged || !changedPlans.empty();
+	}
+
+	bool M_MineDroppingPlanManager::publishChangedPlanLists(const AllPlanListSender& send)
+	{
+		// 송신이 끝날 때까지 다른 발사관이 캐시를 바꾸지 않도록 유지 (저장소 잠금은 복사 동안만 보유)
+		std::lock_guard<std::mutex> publishLock(m_publishMutex);
+		{
+			std::lock_guard<std::mutex> lock(m_storeMutex);
+			if (!m_planStoreLoaded || (m_publishDirtyLists.none() && !m_publishDirtyListCnt)) {
 				return false;
 			}
 
-			// 상태 조회
-			int stateValue = planList["stPlan"][planIndex]["ePlanState"];
-			outState = static_cast<EN_M_MINE_PLAN_STATE>(stateValue);
+			m_allPlanListMsg.usPlanListCnt(m_planStore.usPlanListCnt());
+			for (int i = 0; i < 15; i++) {
+				if (m_publishDirtyLists.test(i)) {
+					m_allPlanListMsg.stMinePlanList()[i] = m_planStore.stMinePlanList()[i];
+				}
+			}
 
-			return true;
+			m_publishDirtyLists.reset();
+			m_publishDirtyListCnt = false;
 		}
-		catch (const json::exception& e) {
-			std::cerr << "JSON parsing error: " << e.what() << std::endl;
+
+		send(m_allPlanListMsg);
+		return true;
+	}
+
+	// 임시 파일에 기록 후 교체 (다른 발사관 프로세스가 읽는 도중 잘린 파일을 보지 않도록)
+	// 변경된 목록만 다시 직렬화하고 나머지는 캐시된 직렬화 결과를 그대로 사용
+	bool M_MineDroppingPlanManager::persistPlanStore(const std::string& filename)
+	{
+		for (int i = 0; i < 15; i++) {
+			if (m_persistDirtyLists.test(i)) {
+				m_planListJson[i].clear();
+				PlanCodec::Write(m_planListJson[i], m_planStore.stMinePlanList()[i], 2 * PlanCodec::IndentWidth);
+			}
+		}
+		m_persistDirtyLists.reset();
+
+		// 최상위 구성과 들여쓰기는 PlanCodec::Write(CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST) 출력과 동일
+		std::string buffer;
+		buffer.reserve(m_planListJson[0].size() * 15 + 128);
+		buffer.append("{\n    \"stMsgHeader\": {},\n    \"usPlanListCnt\": ");
+		buffer.append(std::to_string(m_planStore.usPlanListCnt()));
+		buffer.append(",\n    \"stMinePlanList\": [\n");
+		for (int i = 0; i < 15; i++) {
+			if (i != 0) buffer.append(",\n");
+			buffer.append(2 * PlanCodec::IndentWidth, ' ');
+			buffer.append(m_planListJson[i]);
+		}
+		buffer.append("\n    ]\n}");
+
+		std::string tmpFile = filename + ".tmp." + std::to_string(::getpid());
+		if (!writePlanFile(tmpFile, buffer)) {
 			return false;
 		}
-				catch (const std::exception& e) {
-			std::cerr << "Error getting plan state: " << e.what() << std::endl;
+
+		std::error_code ec;
+		std::filesystem::rename(tmpFile, filename, ec);
+		if (ec) {
+			std::cerr << "Error replacing plan file " << filename << ": " << ec.message() << std::endl;
+			std::filesystem::remove(tmpFile, ec);
 			return false;
 		}
+		return true;
+	}
+
+	// 변경된 부설계획만 스냅샷을 떠서 저장소 잠금 없이 병렬 검증 (planIndex == -1 인 목록 정보 변경은 제외)
+	void M_MineDroppingPlanManager::validatePlans(const std::vector<std::pair<int, int>>& targetPlans)
+	{
+		// 검증끼리는 직렬화하여 나중에 뜬 스냅샷의 결과가 항상 나중에 기록되도록 함
+		std::lock_guard<std::mutex> validationLock(m_validationMutex);
+
+		std::vector<std::pair<int, int>> targets;
+		std::vector<ST_M_MINE_PLAN_INFO> plans;
+		targets.reserve(targetPlans.size());
+		plans.reserve(targetPlans.size());
+		{
+			std::lock_guard<std::mutex> lock(m_storeMutex);
+			for (const auto& target : targetPlans) {
+				if (target.second < 0) continue;
+				targets.push_back(target);
+				plans.push_back(m_planStore.stMinePlanList()[target.first].stPlan()[target.second]);
+			}
+		}
+		if (plans.empty()) return;
+
+		auto startTime = std::chrono::steady_clock::now();
+		std::vector<SAL_MINE_PLAN_FEASIBILITY> results;
+		M_MINE_PlanValidator::EvaluateParallel(plans, results);
+		auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+		int existingCnt{ 0 };
+		int feasibleCnt{ 0 };
+		{
+			std::lock_guard<std::mutex> lock(m_feasibilityMutex);
+			for (size_t i = 0; i < targets.size(); i++) {
+				m_planFeasibility[targets[i].first][targets[i].second] = results[i];
+				if (results[i].bPlanExists) ++existingCnt;
+				if (results[i].isFeasible()) ++feasibleCnt;
+			}
+		}
+
+		DEBUG_STREAM(MINEMANAGER) << "Plan validation: " << plans.size() << " checked, " << existingCnt << " defined, "
+			<< feasibleCnt << " feasible (" << elapsed_ms << " ms)" << std::endl;
+	}
+
+	bool M_MineDroppingPlanManager::getPlanFeasibility(int planListIndex, int planIndex, SAL_MINE_PLAN_FEASIBILITY& outFeasibility)
+	{
+		if (!isValidPlanIndex(planListIndex, planIndex)) {
+			return false;
+		}
+
+		std::lock_guard<std::mutex> lock(m_feasibilityMutex);
+		outFeasibility = m_planFeasibility[planListIndex][planIndex];
+		return outFeasibility.bEvaluated;
+	}
+
+	int M_MineDroppingPlanManager::addPlanChangeListener(PlanChangeListener listener)
+	{
+		std::lock_guard<std::mutex> lock(m_listenerMutex);
+		int listenerId = m_nextListenerId++;
+		m_planChangeListeners[listenerId] = std::make_shared<ListenerSlot<PlanChangeListener>>(std::move(listener));
+		return listenerId;
+	}
+
+	void M_MineDroppingPlanManager::removePlanChangeListener(int listenerId)
+	{
+		std::shared_ptr<ListenerSlot<PlanChangeListener>> slot;
+		{
+			std::lock_guard<std::mutex> lock(m_listenerMutex);
+			auto it = m_planChangeListeners.find(listenerId);
+			if (it == m_planChangeListeners.end()) return;
+			slot = std::move(it->second);
+			m_planChangeListeners.erase(it);
+		}
+		// 다른 스레드에서 통지 중인 복사본이 있으면 그 호출이 끝날 때까지 대기, 이후에는 호출되지 않음
+		std::lock_guard<std::mutex> callLock(slot->callMutex);
+		slot->active = false;
+	}
+
+	int M_MineDroppingPlanManager::addPlanStateListener(PlanStateListener listener)
+	{
+		std::lock_guard<std::mutex> lock(m_listenerMutex);
+		int listenerId = m_nextListenerId++;
+		m_planStateListeners[listenerId] = std::make_shared<ListenerSlot<PlanStateListener>>(std::move(listener));
+		return listenerId;
+	}
+
+	void M_MineDroppingPlanManager::removePlanStateListener(int listenerId)
+	{
+		std::shared_ptr<ListenerSlot<PlanStateListener>> slot;
+		{
+			std::lock_guard<std::mutex> lock(m_listenerMutex);
+			auto it = m_planStateListeners.find(listenerId);
+			if (it == m_planStateListeners.end()) return;
+			slot = std::move(it->second);
+			m_planStateListeners.erase(it);
+		}
+		std::lock_guard<std::mutex> callLock(slot->callMutex);
+		slot->active = false;
+	}
+
+	template <typename Listener, typename... Args>
+	void M_MineDroppingPlanManager::invokeListeners(const std::vector<std::shared_ptr<ListenerSlot<Listener>>>& slots, Args&&... args)
+	{
+		for (const auto& slot : slots) {
+			std::lock_guard<std::mutex> callLock(slot->callMutex);
+			if (slot->active) {
+				slot->callback(args...);
+			}
+		}
+	}
+
+	void M_MineDroppingPlanManager::notifyPlanChanged(const std::vector<std::pair<int, int>>& changedPlans)
+	{
+		// 콜백은 m_listenerMutex 밖에서 호출 (콜백 안의 구독/해제, 다른 잠금과의 순서 역전 방지)
+		std::vector<std::shared_ptr<ListenerSlot<PlanChangeListener>>> slots;
+		{
+			std::lock_guard<std::mutex> lock(m_listenerMutex);
+			slots.reserve(m_planChangeListeners.size());
+			for (const auto& listener : m_planChangeListeners) {
+				slots.push_back(listener.second);
+			}
+		}
+		for (const auto& changed : changedPlans) {
+			invokeListeners(slots, changed.first, changed.second);
+		}
+	}
+
+	void M_MineDroppingPlanManager::notifyPlanStateChanged(const std::vector<PlanStateEvent>& stateEvents)
+	{
+		std::vector<std::shared_ptr<ListenerSlot<PlanStateListener>>> slots;
+		{
+			std::lock_guard<std::mutex> lock(m_listenerMutex);
+			slots.reserve(m_planStateListeners.size());
+			for (const auto& listener : m_planStateListeners) {
+				slots.push_back(listener.second);
+			}
+		}
+		for (const auto& event : stateEvents) {
+			invokeListeners(slots, event);
+		}
 	}
 }
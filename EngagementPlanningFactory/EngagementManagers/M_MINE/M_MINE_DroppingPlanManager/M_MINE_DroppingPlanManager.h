@@ -10,6 +10,11 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <bitset>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include <memory>
 
 #define NOMINMAX
 #include "../../../../dds_message/AIEP_AIEP_.hpp"
@@ -18,12 +23,36 @@
 //#include "AIEP_Defines.h"
 #undef NOMINMAX  // now std::min/std::max work again
 
+#include "M_MINE_PlanCodec.h"
+#include "../M_MINE_Model/M_MINE_TYPES.h"
+
 namespace AIEP {
 using json = nlohmann::json;
 
 	class M_MineDroppingPlanManager
 	{
 	public:
+		// 부설계획 변경 통지 콜백 (planIndex == -1 이면 부설계획 목록 자체의 정보 변경)
+		using PlanChangeListener = std::function<void(int planListIndex, int planIndex)>;
+
+		// 부설계획 상태 전이 이벤트
+		struct PlanStateEvent
+		{
+			int tubeNumber;						// 상태를 변경한 발사관 (0: 외부 편집/파일 변경)
+			int planListIndex;
+			int planIndex;
+			EN_M_MINE_PLAN_STATE oldState;
+			EN_M_MINE_PLAN_STATE newState;
+		};
+		using PlanStateListener = std::function<void(const PlanStateEvent& event)>;
+
+		// AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST 송신 함수 (저장소 송신 캐시를 전달)
+		using AllPlanListSender = std::function<void(AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST& msg)>;
+
+		inline static const std::string MINE_PLAN_FILE = "Hello.json"; // 부설계획 파일 이름
+
+		static M_MineDroppingPlanManager& GetInstance();
+
 		json pointToJson(const ST_WEAPON_WAYPOINT& pt);
 		json waypointToJson(const ST_M_MINE_PLAN_OWNSHIP_WAYPOINT& wpt);
 		json createEmptyPlanJson();
@@ -59,11 +88,86 @@ using json = nlohmann::json;
 		bool updatePlanState(const std::string& filename,
 			int planListIndex,
 			int planIndex,
-			EN_M_MINE_PLAN_STATE newState);
+			EN_M_MINE_PLAN_STATE newState,
+			int tubeNumber = 0);
 		bool getPlanState(const std::string& filename,
 			int planListIndex,
 			int planIndex,
 			EN_M_MINE_PLAN_STATE& outState);
 
+		// ==========================================================================
+		// 메모리 내 부설계획 저장소 (변경분만 반영)
+		// 파일은 발사관 프로세스 간 공유: 기록 전 잠금 파일(<파일>.lock)로 직렬화하고 최신 내용을 먼저 반영
+		// ==========================================================================
+		bool loadPlanStore(const std::string& filename);
+		bool applyEditedPlanList(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& msg, const std::string& filename);
+		bool reloadPlanStore(const std::string& filename); // 파일 변경 감시(FileWatcher)에서 호출
+		// 마지막 송신 이후 변경된 목록만 저장소의 송신 캐시에 복사한 뒤 send 호출, 변경 없으면 false
+		// (캐시는 모든 발사관이 공유하므로 어느 발사관이 송신해도 15개 목록이 모두 최신 상태)
+		bool publishChangedPlanLists(const AllPlanListSender& send);
+
+		// 사전 검증 결과 조회 (저장소 로드 시 작업 풀에서, 편집 시 병렬 산출), 검증 전이면 false
+		bool getPlanFeasibility(int planListIndex, int planIndex, SAL_MINE_PLAN_FEASIBILITY& outFeasibility);
+
+		int addPlanChangeListener(PlanChangeListener listener);
+		void removePlanChangeListener(int listenerId);
+
+		// 상태 전이 구독 (파일 재조회 없이 전이 시점에 통지)
+		int addPlanStateListener(PlanStateListener listener);
+		void removePlanStateListener(int listenerId);
+
+	private:
+		M_MineDroppingPlanManager() = default;
+		~M_MineDroppingPlanManager() = default;
+		M_MineDroppingPlanManager(const M_MineDroppingPlanManager&) = delete;
+		M_MineDroppingPlanManager& operator=(const M_MineDroppingPlanManager&) = delete;
+
+		json planInfoToJson(const ST_M_MINE_PLAN_INFO& info);
+		template <typename T>
+		bool readPlanFile(const std::string& filename, T& msg);
+		bool writePlanFile(const std::string& filename, const std::string& buffer);
+		bool isValidPlanIndex(int planListIndex, int planIndex) const;
+		// 변경된 목록/부설계획만 저장소에 반영, 변경 여부 반환 (m_storeMutex 보유 상태에서 호출)
+		bool mergePlanListLocked(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& msg, std::vector<std::pair<int, int>>& changedPlans,
+			std::vector<PlanStateEvent>& stateEvents);
+		bool syncFromFileLocked(const std::string& filename, std::vector<std::pair<int, int>>& changedPlans,
+			std::vector<PlanStateEvent>& stateEvents); // m_storeMutex 와 파일 잠금 보유 상태에서 호출
+		bool persistPlanStore(const std::string& filename); // m_storeMutex 와 파일 잠금 보유 상태에서 호출
+		void notifyPlanChanged(const std::vector<std::pair<int, int>>& changedPlans);
+		void notifyPlanStateChanged(const std::vector<PlanStateEvent>& stateEvents);
+		void validatePlans(const std::vector<std::pair<int, int>>& targetPlans); // m_storeMutex 미보유 상태에서 호출
+
+		CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST m_planStore{};	// 전체 부설계획 (15 x 15)
+		std::array<std::string, 15> m_planListJson;		// 목록별 직렬화 결과 캐시
+		std::bitset<15> m_persistDirtyLists;				// 파일 기록 시 다시 직렬화할 목록
+		std::string m_planStoreFile;
+		bool m_planStoreLoaded{ false };
+
+		std::bitset<15> m_publishDirtyLists;	// 송신 캐시에 아직 반영되지 않은 목록
+		bool m_publishDirtyListCnt{ false };
+		std::mutex m_storeMutex;
+
+		AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST m_allPlanListMsg{};	// 송신 캐시 (m_publishMutex 보호)
+		std::mutex m_publishMutex;	// 캐시 갱신과 송신 직렬화 (m_storeMutex 보다 먼저 잠금)
+
+		std::array<std::array<SAL_MINE_PLAN_FEASIBILITY, 15>, 15> m_planFeasibility{};
+		std::mutex m_feasibilityMutex;
+		std::mutex m_validationMutex;	// validatePlans 실행 직렬화 (작업 풀의 최초 전체 검증과 편집 검증)
+
+		// 통지는 목록 복사본으로 m_listenerMutex 밖에서 호출, 해제는 해당 리스너의 진행 중 호출만 대기
+		template <typename Listener>
+		struct ListenerSlot {
+			explicit ListenerSlot(Listener cb) : callback(std::move(cb)) {}
+			Listener callback;
+			std::mutex callMutex;	// 호출과 해제를 직렬화 (콜백 안에서 자기 해제 금지)
+			bool active{ true };	// callMutex 보호, 해제 후 false
+		};
+		template <typename Listener, typename... Args>
+		static void invokeListeners(const std::vector<std::shared_ptr<ListenerSlot<Listener>>>& slots, Args&&... args);
+
+		std::map<int, std::shared_ptr<ListenerSlot<PlanChangeListener>>> m_planChangeListeners;
+		std::map<int, std::shared_ptr<ListenerSlot<PlanStateListener>>> m_planStateListeners;
+		int m_nextListenerId{ 1 };
+		std::mutex m_listenerMutex;
 	};
 }
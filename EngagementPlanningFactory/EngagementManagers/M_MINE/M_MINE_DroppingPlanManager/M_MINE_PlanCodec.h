@@ -0,0 +1,679 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#define NOMINMAX
+#include "../../../../dds_message/AIEP_AIEP_.hpp"
+#include "json.hpp"
+#undef NOMINMAX
+
+namespace AIEP {
+namespace PlanCodec {
+	using json = nlohmann::json;
+
+	// ==========================================================================
+	// 구조체 필드 기술
+	// 구조체당 한 번만 기술하고, JSON 읽기/쓰기 코드는 아래 템플릿이 컴파일 시 생성
+	// ==========================================================================
+	template <typename Accessor>
+	struct Field
+	{
+		std::string_view name;
+		Accessor access;	// const 객체면 값/const 참조, 비 const 객체면 참조 반환
+	};
+
+	template <typename Accessor>
+	constexpr Field<Accessor> MakeField(std::string_view name, Accessor access)
+	{
+		return { name, access };
+	}
+
+#define PLAN_CODEC_FIELD(member) \
+	MakeField(#member, [](auto& obj) -> decltype(auto) { return (obj.member()); })
+
+	template <typename T>
+	struct Schema; // 기술되지 않은 타입은 정의하지 않음
+
+	template <>
+	struct Schema<ST_WEAPON_WAYPOINT>
+	{
+		static constexpr bool hasMsgHeader = false;
+		static constexpr auto fields()
+		{
+			return std::make_tuple(
+				PLAN_CODEC_FIELD(dLatitude),
+				PLAN_CODEC_FIELD(dLongitude),
+				PLAN_CODEC_FIELD(fDepth),
+				PLAN_CODEC_FIELD(fSpeed),
+				PLAN_CODEC_FIELD(bValid));
+		}
+	};
+
+	template <>
+	struct Schema<ST_M_MINE_PLAN_OWNSHIP_WAYPOINT>
+	{
+		static constexpr bool hasMsgHeader = false;
+		static constexpr auto fields()
+		{
+			return std::make_tuple(
+				PLAN_CODEC_FIELD(dLatitude),
+				PLAN_CODEC_FIELD(dLongitude),
+				PLAN_CODEC_FIELD(fDepth),
+				PLAN_CODEC_FIELD(fSpeed),
+				PLAN_CODEC_FIELD(fHeading),
+				PLAN_CODEC_FIELD(bLaunchPoint),
+				PLAN_CODEC_FIELD(usListID));
+		}
+	};
+
+	template <>
+	struct Schema<ST_M_MINE_PLAN_INFO>
+	{
+		static constexpr bool hasMsgHeader = false;
+		static constexpr auto fields()
+		{
+			return std::make_tuple(
+				PLAN_CODEC_FIELD(sListID),
+				PLAN_CODEC_FIELD(usDroppingPlanNumber),
+				PLAN_CODEC_FIELD(ePlanState),
+				PLAN_CODEC_FIELD(usWeaponID),
+				PLAN_CODEC_FIELD(cAdditionalText),
+				PLAN_CODEC_FIELD(stDropPos),
+				PLAN_CODEC_FIELD(stLaunchPos),
+				PLAN_CODEC_FIELD(usWaypointCnt),
+				PLAN_CODEC_FIELD(stWaypoint));	// 8개
+		}
+	};
+
+	template <>
+	struct Schema<ST_M_MINE_PLAN_LIST>
+	{
+		static constexpr bool hasMsgHeader = false;
+		static constexpr auto fields()
+		{
+			return std::make_tuple(
+				PLAN_CODEC_FIELD(chDescription),
+				PLAN_CODEC_FIELD(sListID),
+				PLAN_CODEC_FIELD(usOwnshipWaypointCnt),
+				PLAN_CODEC_FIELD(stPlan),				// 15개
+				PLAN_CODEC_FIELD(stOwnshipWaypoint));	// 40개
+		}
+	};
+
+	// 파일 형식 호환을 위해 메시지 최상위에는 빈 stMsgHeader 객체를 기록
+	template <>
+	struct Schema<CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST>
+	{
+		static constexpr bool hasMsgHeader = true;
+		static constexpr auto fields()
+		{
+			return std::make_tuple(
+				PLAN_CODEC_FIELD(usPlanListCnt),
+				PLAN_CODEC_FIELD(stMinePlanList));		// 15개
+		}
+	};
+
+	template <>
+	struct Schema<AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST>
+	{
+		static constexpr bool hasMsgHeader = true;
+		static constexpr auto fields()
+		{
+			return std::make_tuple(
+				PLAN_CODEC_FIELD(usPlanListCnt),
+				PLAN_CODEC_FIELD(stMinePlanList));
+		}
+	};
+
+#undef PLAN_CODEC_FIELD
+
+	// ==========================================================================
+	// 타입 분류
+	// ==========================================================================
+	template <typename T, typename = void>
+	struct IsDescribed : std::false_type {};
+	template <typename T>
+	struct IsDescribed<T, std::void_t<decltype(Schema<T>::fields())>> : std::true_type {};
+
+	template <typename T, typename = void>
+	struct IsFixedArray : std::false_type {};
+	template <typename T>
+	struct IsFixedArray<T, std::void_t<decltype(std::tuple_size<T>::value), typename T::value_type>> : std::true_type {};
+
+	template <typename T, bool = IsFixedArray<T>::value>
+	struct IsCharArrayImpl : std::false_type {};
+	template <typename T>
+	struct IsCharArrayImpl<T, true> : std::is_same<typename T::value_type, char> {};
+
+	template <typename T>
+	inline constexpr bool IsCharArray = IsCharArrayImpl<T>::value;
+
+	template <typename>
+	inline constexpr bool AlwaysFalse = false;
+
+	template <typename T, typename Visitor>
+	constexpr void ForEachField(Visitor&& visitor)
+	{
+		std::apply([&](const auto&... field) { (visitor(field), ...); }, Schema<T>::fields());
+	}
+
+	// ==========================================================================
+	// 버퍼 직렬화 (중간 json 객체 없이 char 버퍼에 바로 기록)
+	// 기존 파일과 같은 형식 유지: nlohmann dump(4) 들여쓰기, char 배열은 정수 배열
+	// ==========================================================================
+	inline constexpr size_t IndentWidth = 4;
+
+	namespace detail {
+		inline void WriteIndent(std::string& out, size_t indent)
+		{
+			out.append(indent, ' ');
+		}
+
+		template <typename T>
+		void WriteNumber(std::string& out, T value)
+		{
+			char buffer[64];
+			if constexpr (std::is_floating_point_v<T>) {
+				// nlohmann 과 같이 double 로 기록, 정수 값은 ".0", 지수는 소수점 위치가 (-4, 15] 밖일 때만
+				double number = static_cast<double>(value);
+				if (!std::isfinite(number)) {
+					out.append("null");
+					return;
+				}
+				auto result = std::to_chars(buffer, buffer + sizeof(buffer), number, std::chars_format::scientific);
+				const char* exponent = std::find(buffer, result.ptr, 'e');
+				int decimalPoint{ 0 };
+				std::from_chars(exponent + 1 + (exponent[1] == '+' ? 1 : 0), result.ptr, decimalPoint);
+				decimalPoint += 1;
+				if (decimalPoint > -4 && decimalPoint <= 15) {
+					result = std::to_chars(buffer, buffer + sizeof(buffer), number, std::chars_format::fixed);
+					out.append(buffer, result.ptr);
+					if (std::find(buffer, result.ptr, '.') == result.ptr) {
+						out.append(".0");
+					}
+				}
+				else {
+					out.append(buffer, result.ptr);
+				}
+			}
+			else {
+				auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+				out.append(buffer, result.ptr);
+			}
+		}
+
+		// 읽기(ReadCharArray/FromJson)와 같이 최대 maxLen-1 글자 + 0 종단, 배열 전체 길이로 기록
+		inline void WriteCharArray(std::string& out, const char* data, size_t maxLen, size_t indent)
+		{
+			if (maxLen == 0) {
+				out.append("[]");
+				return;
+			}
+			size_t length = strnlen(data, maxLen - 1);
+			out.append("[\n");
+			for (size_t i = 0; i < maxLen; ++i) {
+				if (i != 0) out.append(",\n");
+				WriteIndent(out, indent + IndentWidth);
+				WriteNumber(out, (i < length) ? static_cast<int>(data[i]) : 0);
+			}
+			out.push_back('\n');
+			WriteIndent(out, indent);
+			out.push_back(']');
+		}
+
+		// 정수/열거형은 정수 값이면서 (기반) 타입 범위 안, 실수는 유한하고 타입 범위 안
+		template <typename V>
+		bool InRange(double number)
+		{
+			if constexpr (std::is_enum_v<V>) {
+				return InRange<std::underlying_type_t<V>>(number);
+			}
+			else if constexpr (std::is_integral_v<V>) {
+				return std::isfinite(number) && std::trunc(number) == number
+					&& number >= static_cast<double>(std::numeric_limits<V>::min())
+					&& number <= static_cast<double>(std::numeric_limits<V>::max());
+			}
+			else {
+				return std::isfinite(number) && std::fabs(number) <= static_cast<double>(std::numeric_limits<V>::max());
+			}
+		}
+	}
+
+	// indent: 값이 시작되는 줄의 들여쓰기 (닫는 괄호 위치), 하위 요소는 IndentWidth 만큼 더 들여씀
+	template <typename T>
+	void Write(std::string& out, const T& value, size_t indent = 0)
+	{
+		using V = std::decay_t<T>;
+
+		if constexpr (IsDescribed<V>::value) {
+			out.append("{\n");
+			bool first = true;
+			if constexpr (Schema<V>::hasMsgHeader) {
+				detail::WriteIndent(out, indent + IndentWidth);
+				out.append("\"stMsgHeader\": {}");
+				first = false;
+			}
+			ForEachField<V>([&](const auto& field) {
+				if (!first) out.append(",\n");
+				first = false;
+				detail::WriteIndent(out, indent + IndentWidth);
+				out.push_back('"');
+				out.append(field.name);
+				out.append("\": ");
+				Write(out, field.access(value), indent + IndentWidth);
+				});
+			out.push_back('\n');
+			detail::WriteIndent(out, indent);
+			out.push_back('}');
+		}
+		else if constexpr (IsCharArray<V>) {
+			detail::WriteCharArray(out, value.data(), value.size(), indent);
+		}
+		else if constexpr (IsFixedArray<V>::value) {
+			if (value.size() == 0) {
+				out.append("[]");
+				return;
+			}
+			out.append("[\n");
+			for (size_t i = 0; i < value.size(); ++i) {
+				if (i != 0) out.append(",\n");
+				detail::WriteIndent(out, indent + IndentWidth);
+				Write(out, value[i], indent + IndentWidth);
+			}
+			out.push_back('\n');
+			detail::WriteIndent(out, indent);
+			out.push_back(']');
+		}
+		else if constexpr (std::is_same_v<V, bool>) {
+			out.append(value ? "true" : "false");
+		}
+		else if constexpr (std::is_enum_v<V>) {
+			detail::WriteNumber(out, static_cast<std::underlying_type_t<V>>(value));
+		}
+		else if constexpr (std::is_arithmetic_v<V>) {
+			detail::WriteNumber(out, value);
+		}
+		else {
+			static_assert(AlwaysFalse<V>, "PlanCodec: type has no Schema description");
+		}
+	}
+
+	// ==========================================================================
+	// 버퍼 역직렬화 (DOM 생성 없이 대상 구조체에 바로 기록)
+	// 기술되지 않은 키는 건너뛰고, 없는 필드는 0으로 유지
+	// ==========================================================================
+	class BufferReader
+	{
+	public:
+		BufferReader(const char* begin, const char* end) : m_pos(begin), m_end(end) {}
+
+		template <typename T>
+		bool Read(T& value)
+		{
+			value = T{};
+			return ReadValue(value) && (SkipWhitespace(), m_pos == m_end);
+		}
+
+	private:
+		template <typename T>
+		bool ReadValue(T& value)
+		{
+			using V = std::decay_t<T>;
+			SkipWhitespace();
+
+			if constexpr (IsDescribed<V>::value) {
+				return ReadObject(value);
+			}
+			else if constexpr (IsCharArray<V>) {
+				return ReadCharArray(value.data(), value.size());
+			}
+			else if constexpr (IsFixedArray<V>::value) {
+				if (!Consume('[')) return false;
+				SkipWhitespace();
+				if (Consume(']')) return true;
+				for (size_t i = 0; ; ++i) {
+					bool ok = (i < value.size()) ? ReadValue(value[i]) : SkipValue();
+					if (!ok) return false;
+					SkipWhitespace();
+					if (Consume(']')) return true;
+					if (!Consume(',')) return false;
+				}
+			}
+			else if constexpr (std::is_same_v<V, bool>) {
+				double number{ 0. };
+				if (!ReadNumber(number)) return false;
+				value = (number != 0.);
+				return true;
+			}
+			else if constexpr (std::is_enum_v<V> || std::is_arithmetic_v<V>) {
+				double number{ 0. };
+				if (!ReadNumber(number)) return false;
+				if (!detail::InRange<V>(number)) return false;	// 범위 밖 값은 변환하지 않고 파일 오류로 처리
+				value = static_cast<V>(number);
+				return true;
+			}
+			else {
+				static_assert(AlwaysFalse<V>, "PlanCodec: type has no Schema description");
+			}
+		}
+
+		template <typename T>
+		bool ReadObject(T& value)
+		{
+			if (!Consume('{')) return false;
+			SkipWhitespace();
+			if (Consume('}')) return true;
+
+			while (true) {
+				std::string_view key;
+				SkipWhitespace();
+				if (!ReadKey(key)) return false;
+				SkipWhitespace();
+				if (!Consume(':')) return false;
+
+				bool matched{ false };
+				bool ok{ true };
+				ForEachField<T>([&](const auto& field) {
+					if (!matched && field.name == key) {
+						matched = true;
+						ok = ReadValue(field.access(value));
+					}
+					});
+				if (!matched) ok = SkipValue();
+				if (!ok) return false;
+
+				SkipWhitespace();
+				if (Consume('}')) return true;
+				if (!Consume(',')) return false;
+			}
+		}
+
+		// 숫자, true/false/null 모두 수치로 해석 (기존 파일의 0. 표기 호환)
+		bool ReadNumber(double& out)
+		{
+			if (Match("true")) { out = 1.; return true; }
+			if (Match("false") || Match("null")) { out = 0.; return true; }
+
+			auto result = std::from_chars(m_pos, m_end, out);
+			if (result.ec != std::errc()) return false;
+			m_pos = result.ptr;
+			return true;
+		}
+
+		// 문자열 또는 기존 nlohmann 형식의 정수 배열 모두 허용, 최대 maxLen-1 글자 (WriteCharArray 와 동일)
+		bool ReadCharArray(char* dest, size_t maxLen)
+		{
+			std::memset(dest, 0, maxLen);
+			size_t length{ 0 };
+			auto put = [&](char c) { if (length + 1 < maxLen) dest[length++] = c; };
+
+			if (Consume('[')) {
+				bool terminated{ false };
+				SkipWhitespace();
+				if (Consume(']')) return true;
+				while (true) {
+					double number{ 0. };
+					SkipWhitespace();
+					if (!ReadNumber(number)) return false;
+					// 기존 형식은 char 를 부호 있는 정수로 기록, 바이트 값(0~255)도 허용
+					if (!detail::InRange<signed char>(number) && !detail::InRange<unsigned char>(number)) return false;
+					if (number == 0.) terminated = true;
+					if (!terminated) put(static_cast<char>(static_cast<int>(number)));
+					SkipWhitespace();
+					if (Consume(']')) return true;
+					if (!Consume(',')) return false;
+				}
+			}
+
+			if (!Consume('"')) return false;
+			return ReadStringBody(put);
+		}
+
+		// 여는 따옴표 다음부터 닫는 따옴표까지 이스케이프를 풀어 put 으로 전달
+		template <typename Put>
+		bool ReadStringBody(Put&& put)
+		{
+			while (m_pos < m_end && *m_pos != '"') {
+				char c = *m_pos++;
+				if (c != '\\') {
+					put(c);
+					continue;
+				}
+				if (m_pos >= m_end) return false;
+				char escaped = *m_pos++;
+				switch (escaped) {
+				case 'n': put('\n'); break;
+				case 'r': put('\r'); break;
+				case 't': put('\t'); break;
+				case 'b': put('\b'); break;
+				case 'f': put('\f'); break;
+				case 'u': {
+					unsigned int code{ 0 };
+					if (m_end - m_pos < 4) return false;
+					auto result = std::from_chars(m_pos, m_pos + 4, code, 16);
+					if (result.ptr != m_pos + 4) return false;
+					m_pos += 4;
+					// BMP 범위만 UTF-8로 변환 (대리쌍은 사용하지 않음)
+					if (code < 0x80) {
+						put(static_cast<char>(code));
+					}
+					else if (code < 0x800) {
+						put(static_cast<char>(0xC0 | (code >> 6)));
+						put(static_cast<char>(0x80 | (code & 0x3F)));
+					}
+					else {
+						put(static_cast<char>(0xE0 | (code >> 12)));
+						put(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+						put(static_cast<char>(0x80 | (code & 0x3F)));
+					}
+					break;
+				}
+				default: put(escaped); break; // \" \\ \/
+				}
+			}
+			return Consume('"');
+		}
+
+		// 이스케이프가 없으면 버퍼를 그대로 참조, 있으면 풀어서 m_keyBuffer 에 보관 (다음 키 읽기 전까지 유효)
+		bool ReadKey(std::string_view& key)
+		{
+			if (!Consume('"')) return false;
+			const char* start = m_pos;
+			while (m_pos < m_end && *m_pos != '"' && *m_pos != '\\') {
+				++m_pos;
+			}
+			if (m_pos >= m_end) return false;
+			if (*m_pos == '"') {
+				key = std::string_view(start, static_cast<size_t>(m_pos - start));
+				++m_pos;
+				return true;
+			}
+
+			m_keyBuffer.assign(start, m_pos);
+			if (!ReadStringBody([this](char c) { m_keyBuffer.push_back(c); })) return false;
+			key = m_keyBuffer;
+			return true;
+		}
+
+		bool SkipValue()
+		{
+			SkipWhitespace();
+			if (m_pos >= m_end) return false;
+
+			if (*m_pos == '"') {
+				std::string_view ignored;
+				return ReadKey(ignored);
+			}
+			if (*m_pos == '{' || *m_pos == '[') {
+				char close = (*m_pos == '{') ? '}' : ']';
+				++m_pos;
+				SkipWhitespace();
+				if (Consume(close)) return true;
+				while (true) {
+					if (close == '}') {
+						std::string_view ignored;
+						SkipWhitespace();
+						if (!ReadKey(ignored)) return false;
+						SkipWhitespace();
+						if (!Consume(':')) return false;
+					}
+					if (!SkipValue()) return false;
+					SkipWhitespace();
+					if (Consume(close)) return true;
+					if (!Consume(',')) return false;
+				}
+			}
+			double ignored{ 0. };
+			return ReadNumber(ignored);
+		}
+
+		void SkipWhitespace()
+		{
+			while (m_pos < m_end && (*m_pos == ' ' || *m_pos == '\n' || *m_pos == '\r' || *m_pos == '\t')) {
+				++m_pos;
+			}
+		}
+
+		bool Consume(char c)
+		{
+			if (m_pos < m_end && *m_pos == c) {
+				++m_pos;
+				return true;
+			}
+			return false;
+		}
+
+		bool Match(std::string_view literal)
+		{
+			if (static_cast<size_t>(m_end - m_pos) >= literal.size()
+				&& std::string_view(m_pos, literal.size()) == literal) {
+				m_pos += literal.size();
+				return true;
+			}
+			return false;
+		}
+
+		const char* m_pos;
+		const char* m_end;
+		std::string m_keyBuffer;
+	};
+
+	template <typename T>
+	bool Read(const std::string& buffer, T& value)
+	{
+		BufferReader reader(buffer.data(), buffer.data() + buffer.size());
+		return reader.Read(value);
+	}
+
+	// ==========================================================================
+	// nlohmann::json DOM 변환 (기존 json 기반 인터페이스용, 같은 기술 정보 사용)
+	// ==========================================================================
+	template <typename T>
+	json ToJson(const T& value)
+	{
+		using V = std::decay_t<T>;
+
+		if constexpr (IsDescribed<V>::value) {
+			json j = json::object();
+			if constexpr (Schema<V>::hasMsgHeader) {
+				j["stMsgHeader"] = json::object();
+			}
+			ForEachField<V>([&](const auto& field) {
+				j[std::string(field.name)] = ToJson(field.access(value));
+				});
+			return j;
+		}
+		else if constexpr (IsCharArray<V>) {
+			// 기존 ddsMessageToJson 과 같이 정수 배열, 글자 수는 WriteCharArray 와 동일
+			json j = json::array();
+			size_t length = (value.size() == 0) ? 0 : strnlen(value.data(), value.size() - 1);
+			for (size_t i = 0; i < value.size(); ++i) {
+				j.push_back((i < length) ? static_cast<int>(value[i]) : 0);
+			}
+			return j;
+		}
+		else if constexpr (IsFixedArray<V>::value) {
+			json j = json::array();
+			for (const auto& element : value) {
+				j.push_back(ToJson(element));
+			}
+			return j;
+		}
+		else if constexpr (std::is_enum_v<V>) {
+			return static_cast<std::underlying_type_t<V>>(value);
+		}
+		else {
+			return value;
+		}
+	}
+
+	template <typename T>
+	void FromJson(const json& j, T& value)
+	{
+		using V = std::decay_t<T>;
+
+		if constexpr (IsDescribed<V>::value) {
+			if (!j.is_object()) return;
+			ForEachField<V>([&](const auto& field) {
+				auto it = j.find(std::string(field.name));
+				if (it != j.end()) {
+					FromJson(*it, field.access(value));
+				}
+				});
+		}
+		else if constexpr (IsCharArray<V>) {
+			std::string text;
+			if (j.is_string()) {
+				text = j.get<std::string>();
+			}
+			else if (j.is_array()) {
+				for (const auto& ch : j) {
+					int c = ch.get<int>();
+					if (c == 0) break;
+					text.push_back(static_cast<char>(c));
+				}
+			}
+			std::memset(value.data(), 0, value.size());
+			std::memcpy(value.data(), text.data(), std::min(text.size(), value.size() - 1));
+		}
+		else if constexpr (IsFixedArray<V>::value) {
+			if (!j.is_array()) return;
+			size_t count = std::min<size_t>(j.size(), value.size());
+			for (size_t i = 0; i < count; ++i) {
+				FromJson(j[i], value[i]);
+			}
+		}
+		else {
+			if (j.is_boolean()) {
+				value = static_cast<V>(j.get<bool>() ? 1 : 0);
+			}
+			else if (j.is_number()) {
+				double number = j.get<double>();
+				if constexpr (std::is_same_v<V, bool>) {
+					value = (number != 0.);
+				}
+				else if (detail::InRange<V>(number)) {
+					value = static_cast<V>(number);
+				}
+			}
+		}
+	}
+
+	template <typename T>
+	void FromJsonMessage(const json& j, T& value)
+	{
+		value = T{};
+		FromJson(j, value);
+	}
+
+} // namespace PlanCodec
+} // namespace AIEP
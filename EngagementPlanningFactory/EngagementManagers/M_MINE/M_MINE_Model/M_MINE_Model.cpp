@@ -6,8 +6,7 @@ namespace AIEP {
 		memset(&m_DropPos, 0, sizeof(m_DropPos));
 		memset(&m_LaunchPos, 0, sizeof(m_LaunchPos));
         m_weaponKind = static_cast<uint32_t>(EWF_WEAPON_TYPE::WF_WEAPON_TYPE_MMINE);
-        auto& config = ConfigManager::GetInstance();
-        m_weaponSpec = config.GetWeaponSpec(m_weaponKind);
+        m_weaponSpec = ConfigManager::GetInstance().GetSnapshot()->GetWeaponSpec(m_weaponKind);
 	}
 
 	M_MINE_Model::~M_MINE_Model()
@@ -0,0 +1,103 @@
+#include "M_MINE_PlanValidator.h"
+#include "../../utils/AIEP_DataConverter.h"
+#include "../../utils/CCalcMethod.h"
+#include "../../../../Common/Utils/WorkStealingPool.h"
+
+#include <algorithm>
+
+namespace AIEP {
+
+	SAL_MINE_PLAN_FEASIBILITY M_MINE_PlanValidator::Evaluate(const ST_M_MINE_PLAN_INFO& plan, const WeaponSpecification& weaponSpec, M_MINE_Model& model)
+	{
+		SAL_MINE_PLAN_FEASIBILITY result{};
+		result.bEvaluated = true;
+		result.bPlanExists = (plan.usDroppingPlanNumber() != 0);
+		if (!result.bPlanExists) {
+			return result;
+		}
+
+		// 발사 지점 기준 ENU 경로 구성 (Launch point -> Waypoints -> Drop point)
+		GEO_POINT_2D center{ plan.stLaunchPos().dLatitude(), plan.stLaunchPos().dLongitude() };
+		std::vector<SPOINT_WEAPON_ENU> route;
+		route.reserve(10);
+
+		SPOINT_WEAPON_ENU point{};
+		DataConverter::convertLatLonAltToLocal(center, plan.stLaunchPos().dLatitude(), plan.stLaunchPos().dLongitude(), -plan.stLaunchPos().fDepth(), point);
+		route.push_back(point);
+
+		int waypointCnt = std::min<int>(plan.usWaypointCnt(), 8);
+		for (int i = 0; i < waypointCnt; i++)
+		{
+			const auto& waypoint = plan.stWaypoint()[i];
+			if (!waypoint.bValid()) continue;
+
+			point = SPOINT_WEAPON_ENU{};
+			DataConverter::convertLatLonAltToLocal(center, waypoint.dLatitude(), waypoint.dLongitude(), -waypoint.fDepth(), point);
+			point.Validation = true;
+			route.push_back(point);
+		}
+
+		point = SPOINT_WEAPON_ENU{};
+		DataConverter::convertLatLonAltToLocal(center, plan.stDropPos().dLatitude(), plan.stDropPos().dLongitude(), -plan.stDropPos().fDepth(), point);
+		route.push_back(point);
+
+		// 1. 사거리 (수평 경로 길이)
+		double routeLength{ 0. };
+		for (size_t i = 0; i + 1 < route.size(); i++)
+		{
+			routeLength += CCalcMethod::GetDistance(route[i].E, route[i].N, route[i + 1].E, route[i + 1].N);
+		}
+		result.routeLength_m = static_cast<float>(routeLength);
+		result.bWithinRange = (routeLength <= weaponSpec.maxRange_km * 1000.);
+
+		// 2. 궤적 길이 (PlanTrajectory 와 동일한 0.1 sec 단위 기동)
+		int maxSteps_x10 = weaponSpec.maxRunSteps_x10;
+		model.SetFullRoutePoints(route);
+
+		SPOINT_ENU position{ route.front().E, route.front().N, route.front().U };
+		int nextWaypointIdx{ 1 };
+		for (int i = 0; i < maxSteps_x10; i++)
+		{
+			if (model.runWaypoints(0.1f, nextWaypointIdx, position))
+			{
+				result.bDestinationReached = true;
+				result.time_to_destination = (float)(i / 10.0);
+				break;
+			}
+		}
+
+		// 3. 축전지 (EstimateCurrentStatus 와 동일한 소모 모델)
+		double remaining_Wh = weaponSpec.batteryCapacity_Wh - weaponSpec.energyConsumption_WhPerSec * result.time_to_destination;
+		result.batteryAtDrop_percentage = (weaponSpec.batteryCapacity_Wh > 0.) ? (float)(remaining_Wh / weaponSpec.batteryCapacity_Wh * 100.) : 0.f;
+		result.bBatterySufficient = result.bDestinationReached && (remaining_Wh > 0.);
+
+		return result;
+	}
+
+	void M_MINE_PlanValidator::EvaluateParallel(const std::vector<ST_M_MINE_PLAN_INFO>& plans, std::vector<SAL_MINE_PLAN_FEASIBILITY>& results)
+	{
+		results.assign(plans.size(), SAL_MINE_PLAN_FEASIBILITY{});
+		if (plans.empty()) return;
+
+		auto config = ConfigManager::GetInstance().GetSnapshot();
+		const WeaponSpecification& weaponSpec = config->GetWeaponSpec(static_cast<uint32_t>(EWF_WEAPON_TYPE::WF_WEAPON_TYPE_MMINE));
+
+		// 공용 작업 풀에 분할 실행 (유휴 작업자가 가로채 실행, 호출 스레드도 참여)
+		auto& pool = WorkStealingPool::GetInstance();
+		size_t chunkCount = std::min(pool.WorkerCount() + 1, plans.size());
+
+		// 분할별로 모델 인스턴스를 따로 두고, 부설계획을 번갈아 분배 (결과 슬롯이 겹치지 않으므로 잠금 불필요)
+		pool.ParallelFor(chunkCount, [&](size_t chunk) {
+			M_MINE_Model model;
+			for (size_t i = chunk; i < plans.size(); i += chunkCount)
+			{
+				try {
+					results[i] = Evaluate(plans[i], weaponSpec, model);
+				}
+				catch (const std::exception&) {
+					results[i] = SAL_MINE_PLAN_FEASIBILITY{}; // bEvaluated == false
+				}
+			}
+			});
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <vector>
+#include "M_MINE_TYPES.h"
+#include "M_MINE_Model.h"
+#include "../../../../dds_message/AIEP_AIEP_.hpp"
+
+namespace AIEP {
+
+	// =============================================================================
+	// 부설계획 일괄 사전 검증 (사거리 / 궤적 길이 / 축전지)
+	// =============================================================================
+	class M_MINE_PlanValidator
+	{
+	public:
+		// 단일 부설계획 검증, model 은 호출 스레드 전용 인스턴스
+		static SAL_MINE_PLAN_FEASIBILITY Evaluate(const ST_M_MINE_PLAN_INFO& plan, const WeaponSpecification& weaponSpec, M_MINE_Model& model);
+
+		// 부설계획들을 병렬 검증 (results[i] 는 plans[i] 의 결과)
+		static void EvaluateParallel(const std::vector<ST_M_MINE_PLAN_INFO>& plans, std::vector<SAL_MINE_PLAN_FEASIBILITY>& results);
+	};
+}
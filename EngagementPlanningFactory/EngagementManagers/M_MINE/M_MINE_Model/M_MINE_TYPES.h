@@ -6,6 +6,26 @@ namespace AIEP {
 	typedef unsigned char octet;
 	typedef int EWF_TUBE_NUM;
 
+	// 부설계획 사전 검증 결과 (부설계획 파일 로드/편집 시 일괄 산출, 할당 시 조회)
+	// 발사 지점(stLaunchPos) 기준으로 산출하므로 실제 자함 위치 기준 판단은 매 주기 교전계획에서 수행
+	struct SAL_MINE_PLAN_FEASIBILITY
+	{
+		bool bEvaluated;			// 검증 수행 여부
+		bool bPlanExists;			// 부설계획 존재 여부 (usDroppingPlanNumber != 0)
+		bool bWithinRange;			// 발사 지점-경로점-부설 지점 경로 길이가 최대 사거리 이내 (IsInValidLaunchGeometry 기준)
+		bool bDestinationReached;	// 최대 사거리 시간 내 부설 지점 도달 (PlanTrajectory 기준)
+		bool bBatterySufficient;	// 부설 지점 도달 시 축전지 잔량 존재 (EstimateCurrentStatus 기준)
+
+		float routeLength_m;			// 경로 길이 [m]
+		float time_to_destination;		// 부설 지점까지 총 소요 시간 [sec]
+		float batteryAtDrop_percentage;	// 부설 지점 도달 시 축전지 잔량 [percentage]
+
+		bool isFeasible() const
+		{
+			return bEvaluated && bPlanExists && bWithinRange && bDestinationReached && bBatterySufficient;
+		}
+	};
+
 	// 교전계획 결과 (ENU)
 	struct SAL_MINE_EP_RESULT
 	{
@@ -2,10 +2,37 @@
 #include "../utils/AIEP_DataConverter.h"
 #include "../utils/CCalcMethod.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 
 namespace AIEP {
 
+    namespace {
+        // 교전계획 결과 비교 허용 오차 (기준점 변경에 따른 좌표 재변환 오차는 변경으로 보지 않음)
+        constexpr double RESULT_POSITION_TOLERANCE_DEG = 1.0e-7;   // 약 1 cm
+        constexpr float RESULT_DEPTH_TOLERANCE_M = 0.01f;
+
+        // 산출 주기 타이머 지터로 송신이 한 주기씩 밀리지 않도록 둔 여유
+        constexpr double RESULT_SEND_TIMING_SLACK_SEC = 0.05;
+
+        bool IsSameResultPosition(const ST_3D_GEODETIC_POSITION& a, const ST_3D_GEODETIC_POSITION& b)
+        {
+            return std::fabs(a.dLatitude() - b.dLatitude()) <= RESULT_POSITION_TOLERANCE_DEG
+                && std::fabs(a.dLongitude() - b.dLongitude()) <= RESULT_POSITION_TOLERANCE_DEG
+                && std::fabs(a.fDepth() - b.fDepth()) <= RESULT_DEPTH_TOLERANCE_M;
+        }
+
+        // 값이 다를 때만 갱신하고 변경 여부 반환
+        template <typename T, typename V>
+        bool UpdateResultField(T& field, const V& value)
+        {
+            if (field == value) return false;
+            field = value;
+            return true;
+        }
+    }
+
     // =============================================================================
     // MineEngagementManager 구현
     // =============================================================================
@@ -13,6 +40,7 @@ namespace AIEP {
     MineEngagementManager::MineEngagementManager(ST_WA_SESSION weaponAssignInfo,
         std::shared_ptr<AIEP::DdsComm> ddsComm)
         : EngagementManagerBase{ weaponAssignInfo, ddsComm }
+        , DroppingPlanManager{ &M_MineDroppingPlanManager::GetInstance() }
         , m_MineModel{ std::make_unique<M_MINE_Model>() }
         , m_dropPlan{}
         , m_dropPlanLoaded{ false }
@@ -31,16 +59,91 @@ namespace AIEP {
         m_dropPlanListNumber = planListNum - 1;
         m_dropPlanNumber = planNum - 1;
 
-        if (!LoadMineDropPlan(m_dropPlanListNumber, m_dropPlanNumber)) // m_dropPlan loading
+        if (!LoadAssignedDropPlan())
         {
             throw std::runtime_error("Fail to initialize drop plan and dynamics model of M_MINE.");
         }
 
+        SubscribePlanChanges();
+    }
+
+    MineEngagementManager::MineEngagementManager(int tubeNumber, std::shared_ptr<AIEP::DdsComm> ddsComm)
+        : EngagementManagerBase{ tubeNumber, static_cast<uint32_t>(EN_WPN_KIND::WPN_KIND_M_MINE), ddsComm }
+        , DroppingPlanManager{ &M_MineDroppingPlanManager::GetInstance() }
+        , m_MineModel{ std::make_unique<M_MINE_Model>() }
+        , m_dropPlan{}
+        , m_dropPlanLoaded{ false }
+        , m_dropPlanValid{ false }
+        , m_Geowaypoints{}
+        , LaunchPos_Geo{}
+        , TargetPos_Geo{}
+    {
+        SubscribePlanChanges();
+    }
+
+    void MineEngagementManager::SubscribePlanChanges()
+    {
+        m_planChangeListenerId = DroppingPlanManager->addPlanChangeListener([this](int planListIndex, int planIndex) {
+            OnDropPlanEdited(planListIndex, planIndex);
+            });
+    }
+
+    bool MineEngagementManager::LoadAssignedDropPlan()
+    {
+        if (!LoadMineDropPlan(m_dropPlanListNumber, m_dropPlanNumber)) // m_dropPlan loading
+        {
+            return false;
+        }
+        CheckDropPlanFeasibility(m_dropPlanListNumber, m_dropPlanNumber);
+
         m_MineEngagementPlanResult_ENU.cachedPlanState = static_cast<int>(EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_ASSIGN);
-        DroppingPlanManager->updatePlanState(MINE_PLAN_FILE, m_dropPlanListNumber, m_dropPlanNumber, EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_ASSIGN);
+        DroppingPlanManager->updatePlanState(M_MineDroppingPlanManager::MINE_PLAN_FILE, m_dropPlanListNumber, m_dropPlanNumber, EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_ASSIGN, m_tubeNumber);
 
         SetupDynamicsModel();
-        m_Max_sec_x10 = (int)(m_weaponSpec.maxRange_km * 1000.0 / m_weaponSpec.maxSpeed_mps * 10.0);
+        return true;
+    }
+
+    bool MineEngagementManager::PrepareAssignment(const ST_WA_SESSION& weaponAssignInfo)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_planMutex);
+            m_dropPlanListNumber = weaponAssignInfo.usAllocDroppingPlanListNum() - 1;
+            m_dropPlanNumber = weaponAssignInfo.usAllocLayNum() - 1;
+        }
+        m_resultSent = false;   // 새 할당의 첫 결과는 변경 여부와 관계없이 송신
+        return LoadAssignedDropPlan();
+    }
+
+    MineEngagementManager::~MineEngagementManager()
+    {
+        // 파생 멤버가 해제되기 전에 산출 작업/타이머/비동기 흐름 종료 (기본 클래스 소멸자에서는 늦음)
+        Shutdown();
+        DroppingPlanManager->removePlanChangeListener(m_planChangeListenerId);
+
+        DEBUG_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " mine engagement result sent: " << m_resultSentCount
+            << ", suppressed: " << m_resultSuppressedCount
+            << ", trajectory conversions: " << m_trajectoryConversionCount << std::endl;
+    }
+
+    void MineEngagementManager::OnDropPlanEdited(int planListIndex, int planIndex)
+    {
+        // 할당 전(사전 생성 상태)이나 발사 후에는 부설계획 변경을 반영하지 않음
+        if (!IsAssignmentBound() || m_isLaunched.load() || m_shutdown.load()) return;
+
+        uint32_t listNum, planNum;
+        {
+            std::lock_guard<std::mutex> lock(m_planMutex);
+            if (!m_dropPlanLoaded) return;  // 연결된 할당의 계획을 아직 적재하지 않음 (BindAssignment 에서 적재 중)
+            listNum = m_dropPlanListNumber;
+            planNum = m_dropPlanNumber;
+        }
+
+        if (static_cast<uint32_t>(planListIndex) != listNum || static_cast<uint32_t>(planIndex) != planNum) return;
+
+        // 통지 스레드(DDS 수신/파일 감시)에서는 표시만 하고 재적재는 산출 작업에서 수행
+        // (편집 메시지 및 파일 변경 감지 모두 이 경로로 통지됨, 저장소에서 바로 읽으므로 파일 재파싱 없음)
+        m_dropPlanEditPending.store(true);
+        RequestImmediatePlanCycle("drop plan edited");
     }
 
     void MineEngagementManager::EngagementPlanInitializationAfterLaunch()
@@ -53,18 +156,20 @@ namespace AIEP {
         if (m_MineEngagementPlanResult_ENU.cachedPlanState != static_cast<int>(EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_LAUNCH))
         {
             m_MineEngagementPlanResult_ENU.cachedPlanState = static_cast<int>(EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_LAUNCH);
-            DroppingPlanManager->updatePlanState(MINE_PLAN_FILE, m_dropPlanListNumber, m_dropPlanNumber, EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_LAUNCH);
+            DroppingPlanManager->updatePlanState(M_MineDroppingPlanManager::MINE_PLAN_FILE, m_dropPlanListNumber, m_dropPlanNumber, EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_LAUNCH, m_tubeNumber);
         }
 
         {
+            // 발사 통지 스레드에서 호출되므로 주기 스냅샷이 아닌 최신 게시 값 사용
+            auto ownShip = m_ownShipInput.Load();
             std::lock_guard<std::mutex> lock(m_dataMutex);
 
-            center.latitude = m_ownShipInfo.stShipMovementInfo().dShipLatitude();
-            center.longitude = m_ownShipInfo.stShipMovementInfo().dShipLongitude();
+            center.latitude = ownShip->stShipMovementInfo().dShipLatitude();
+            center.longitude = ownShip->stShipMovementInfo().dShipLongitude();
 
-            Latitude = m_ownShipInfo.stShipMovementInfo().dShipLatitude();
-            Longitude = m_ownShipInfo.stShipMovementInfo().dShipLongitude();
-            Altitude = -m_ownShipInfo.stUnderwaterEnvironmentInfo().fDivingDepth();
+            Latitude = ownShip->stShipMovementInfo().dShipLatitude();
+            Longitude = ownShip->stShipMovementInfo().dShipLongitude();
+            Altitude = -ownShip->stUnderwaterEnvironmentInfo().fDivingDepth();
             
             m_MineEngagementPlanResult_ENU.launchPos = center;
         }
@@ -77,6 +182,7 @@ namespace AIEP {
 
         m_MineEngagementPlanResult_ENU.idxOfNextWP = 1;
         m_MineEngagementPlanResult_ENU.timeSinceLaunch_sec = 0.;
+        m_MineEngagementPlanResult_ENU.TotalEnergyConsumed_Wh = 0.;
     }
 
     void MineEngagementManager::UpdateEngagementPlanResult() {
@@ -89,16 +195,24 @@ namespace AIEP {
             }
             else // 발사 전
             {
+                // 편집된 부설계획 반영 (통지 스레드가 아닌 산출 작업에서 적재)
+                if (m_dropPlanEditPending.exchange(false))
+                {
+                    uint32_t listNum, planNum;
+                    {
+                        std::lock_guard<std::mutex> lock(m_planMutex);
+                        listNum = m_dropPlanListNumber;
+                        planNum = m_dropPlanNumber;
+                    }
+                    if (!LoadMineDropPlan(listNum, planNum)) {
+                        DEBUG_ERROR_STREAM(ENGAGEMENT) << "Fail to reload edited drop plan " << std::endl;
+                    }
+                }
+
                 SetupDynamicsModel();
                 PlanTrajectory();
 
-                if (m_dropPlanLoaded && m_dropPlanValid && isInLaunchableArea.load()) {
-                    m_engagementPlanReady.store(true);
-                }
-                else
-                {
-                    m_engagementPlanReady.store(false);
-                }
+                SetEngagementPlanReady(m_dropPlanLoaded && m_dropPlanValid && isInLaunchableArea.load());
             }
         }
         catch (const std::exception& e) {
@@ -110,66 +224,152 @@ namespace AIEP {
         if (!m_ddsComm || m_shutdown.load()) return;
 
         try {
-            AIEP_M_MINE_EP_RESULT result;
-            std::array<ST_WEAPON_WAYPOINT, 8> arrGeoWaypoint;
-            std::array<float, 8> arrWaypointArrivalTime;
-            std::array<ST_3D_GEODETIC_POSITION, 128> arrTrajectory;
-            std::vector<ST_3D_GEODETIC_POSITION> vecGeoTrajectory;
-
-            GEO_POINT_2D center{ 0, };
+            bool planChanged = false;
+            double statusInterval_sec = 0.;
+            double fullRefreshInterval_sec = 0.;
             {
                 std::lock_guard<std::mutex> lock(m_dataMutex);
 
+                GEO_POINT_2D center{ 0, };
                 if (m_isLaunched)
                 {
                     center = m_MineEngagementPlanResult_ENU.launchPos;
                 }
                 else
                 {
-                    center.latitude = m_ownShipInfo.stShipMovementInfo().dShipLatitude();
-                    center.longitude = m_ownShipInfo.stShipMovementInfo().dShipLongitude();
+                    center.latitude = m_cycleInputs.ownShip->stShipMovementInfo().dShipLatitude();
+                    center.longitude = m_cycleInputs.ownShip->stShipMovementInfo().dShipLongitude();
                 }
-                
-                result.enTubeNum() = static_cast<uint32_t>(m_tubeNumber);
-                result.unCntWaypoint() = (unsigned short)m_Geowaypoints.size();
 
-                std::copy(m_Geowaypoints.begin(), m_Geowaypoints.end(), arrGeoWaypoint.begin());
-                result.stWaypoints(arrGeoWaypoint);
+                // 마지막으로 구성한 결과 메시지와 비교하며 바뀐 필드만 갱신
+                planChanged = UpdateResultPlanFields(center);
+                if (UpdateResultStatusFields(center))
+                {
+                    m_resultStatusPending = true;
+                }
 
-                std::copy(m_MineEngagementPlanResult_ENU.waypointsArrivalTimes.begin(), m_MineEngagementPlanResult_ENU.waypointsArrivalTimes.end(), arrWaypointArrivalTime.begin());
-                result.waypointArrivalTime(arrWaypointArrivalTime);
+                statusInterval_sec = m_weaponSpec.resultStatusInterval_sec;
+                fullRefreshInterval_sec = m_weaponSpec.resultFullRefreshInterval_sec;
+            }
+
+            // 계획 변경은 즉시, 상태 값 변경은 상태 송신 간격마다, 변경이 없어도 전체 갱신 간격마다 송신
+            auto now = std::chrono::steady_clock::now();
+            double sinceLastSend_sec = std::chrono::duration<double>(now - m_lastResultSendTime).count() + RESULT_SEND_TIMING_SLACK_SEC;
+            bool refreshDue = !m_resultSent || sinceLastSend_sec >= fullRefreshInterval_sec;
+            bool statusDue = m_resultStatusPending && sinceLastSend_sec >= statusInterval_sec;
+
+            if (!planChanged && !statusDue && !refreshDue)
+            {
+                ++m_resultSuppressedCount;
+                return;
+            }
 
-                result.bValidMslPos() = (bool)m_MineEngagementPlanResult_ENU.bValidMslDRPos;
-                DataConverter::convertLocalENToLatLon(center, m_MineEngagementPlanResult_ENU.mslDRPos.E, m_MineEngagementPlanResult_ENU.mslDRPos.N, result.MslPos().dLatitude(), result.MslPos().dLongitude());
-                result.MslPos().fDepth() = (float)-m_MineEngagementPlanResult_ENU.mslDRPos.U;
+            m_ddsComm->Send(m_resultMessage);
+            m_lastResultSendTime = now;
+            m_resultSent = true;
+            m_resultStatusPending = false;
+            ++m_resultSentCount;
+        }
+        catch (const std::exception& e) {
+            DEBUG_ERROR_STREAM(ENGAGEMENT) << "Failed to send mine engagement result: " << e.what() << std::endl;
+        }
+    }
 
-                result.numberOfNextWP() = m_MineEngagementPlanResult_ENU.idxOfNextWP - 1;
-                result.timeToNextWP() = m_MineEngagementPlanResult_ENU.timeToNextWP;
-                result.unCntTrajectory() = (unsigned short)m_MineEngagementPlanResult_ENU.number_of_trajectory;
+    // 계획 필드 (경로점, 궤적, 부설/발사 지점) 갱신, 재계획으로 바뀐 경우 true
+    bool MineEngagementManager::UpdateResultPlanFields(const GEO_POINT_2D& center)
+    {
+        AIEP_M_MINE_EP_RESULT& result = m_resultMessage;
+        bool changed = false;
 
-                DataConverter::convertLocalArrToGeo(center, m_MineEngagementPlanResult_ENU.trajectory, vecGeoTrajectory);
-                std::copy(vecGeoTrajectory.begin(), vecGeoTrajectory.end(), arrTrajectory.begin());
-                result.stTrajectories(arrTrajectory);
+        changed |= UpdateResultField(result.enTubeNum(), static_cast<uint32_t>(m_tubeNumber));
 
-                result.fEstimatedDrivingTime() = m_MineEngagementPlanResult_ENU.time_to_destination;
-                result.fRemainingTime() = m_MineEngagementPlanResult_ENU.RemainingTime;
+        changed |= UpdateResultField(result.unCntWaypoint(), (unsigned short)m_Geowaypoints.size());
+        auto& waypoints = result.stWaypoints();
+        for (size_t i = 0; i < waypoints.size(); ++i)
+        {
+            changed |= UpdateResultField(waypoints[i], i < m_Geowaypoints.size() ? m_Geowaypoints[i] : ST_WEAPON_WAYPOINT{});
+        }
 
-                result.stDropPos().dLatitude() = m_dropPlan.stDropPos().dLatitude();
-                result.stDropPos().dLongitude() = m_dropPlan.stDropPos().dLongitude();
-                result.stDropPos().fDepth() = m_dropPlan.stDropPos().fDepth();
+        const std::vector<float>& arrivalTimes = m_MineEngagementPlanResult_ENU.waypointsArrivalTimes;
+        auto& resultArrivalTimes = result.waypointArrivalTime();
+        for (size_t i = 0; i < resultArrivalTimes.size(); ++i)
+        {
+            changed |= UpdateResultField(resultArrivalTimes[i], i < arrivalTimes.size() ? arrivalTimes[i] : 0.f);
+        }
 
-                result.stLaunchPos().dLatitude() = m_dropPlan.stLaunchPos().dLatitude();
-                result.stLaunchPos().dLongitude() = m_dropPlan.stLaunchPos().dLongitude();
-                result.stLaunchPos().fDepth() = m_dropPlan.stLaunchPos().fDepth();
+        changed |= UpdateResultField(result.unCntTrajectory(), (unsigned short)m_MineEngagementPlanResult_ENU.number_of_trajectory);
 
-                result.sBatteryCapacity() = (short)m_MineEngagementPlanResult_ENU.BatteryCapacity_percentage;
-                result.fBatteryTime() = (float)m_MineEngagementPlanResult_ENU.BatteryTime_sec;
+        // 궤적 좌표 변환은 ENU 궤적이나 기준점이 바뀐 경우만 (발사 후에는 궤적이 고정되어 변환 없음)
+        if (!IsConvertedTrajectory(center))
+        {
+            DataConverter::convertLocalArrToGeo(center, m_MineEngagementPlanResult_ENU.trajectory, m_geoTrajectory);
+            m_convertedTrajectory = m_MineEngagementPlanResult_ENU.trajectory;
+            m_convertedTrajectoryCenter = center;
+            ++m_trajectoryConversionCount;
+
+            // 자함 이동으로 기준점만 바뀐 경우 변환 결과는 허용 오차 내에서 같으므로 변경으로 보지 않음
+            auto& trajectory = result.stTrajectories();
+            for (size_t i = 0; i < trajectory.size(); ++i)
+            {
+                const ST_3D_GEODETIC_POSITION point = i < m_geoTrajectory.size() ? m_geoTrajectory[i] : ST_3D_GEODETIC_POSITION{};
+                if (!IsSameResultPosition(trajectory[i], point))
+                {
+                    trajectory[i] = point;
+                    changed = true;
+                }
             }
-            m_ddsComm->Send(result);
         }
-        catch (const std::exception& e) {
-            DEBUG_ERROR_STREAM(ENGAGEMENT) << "Failed to send mine engagement result: " << e.what() << std::endl;
+
+        changed |= UpdateResultField(result.fEstimatedDrivingTime(), m_MineEngagementPlanResult_ENU.time_to_destination);
+
+        changed |= UpdateResultField(result.stDropPos().dLatitude(), m_dropPlan.stDropPos().dLatitude());
+        changed |= UpdateResultField(result.stDropPos().dLongitude(), m_dropPlan.stDropPos().dLongitude());
+        changed |= UpdateResultField(result.stDropPos().fDepth(), m_dropPlan.stDropPos().fDepth());
+
+        changed |= UpdateResultField(result.stLaunchPos().dLatitude(), m_dropPlan.stLaunchPos().dLatitude());
+        changed |= UpdateResultField(result.stLaunchPos().dLongitude(), m_dropPlan.stLaunchPos().dLongitude());
+        changed |= UpdateResultField(result.stLaunchPos().fDepth(), m_dropPlan.stLaunchPos().fDepth());
+
+        return changed;
+    }
+
+    // 상태 필드 (탄 위치, 다음 경로점, 잔여 시간, 축전지) 갱신, 값이 바뀐 경우 true
+    bool MineEngagementManager::UpdateResultStatusFields(const GEO_POINT_2D& center)
+    {
+        AIEP_M_MINE_EP_RESULT& result = m_resultMessage;
+        bool changed = false;
+
+        changed |= UpdateResultField(result.bValidMslPos(), (bool)m_MineEngagementPlanResult_ENU.bValidMslDRPos);
+
+        ST_3D_GEODETIC_POSITION mslPos;
+        DataConverter::convertLocalENToLatLon(center, m_MineEngagementPlanResult_ENU.mslDRPos.E, m_MineEngagementPlanResult_ENU.mslDRPos.N, mslPos.dLatitude(), mslPos.dLongitude());
+        mslPos.fDepth() = (float)-m_MineEngagementPlanResult_ENU.mslDRPos.U;
+        if (!IsSameResultPosition(result.MslPos(), mslPos))
+        {
+            result.MslPos() = mslPos;
+            changed = true;
+        }
+
+        changed |= UpdateResultField(result.numberOfNextWP(), m_MineEngagementPlanResult_ENU.idxOfNextWP - 1);
+        changed |= UpdateResultField(result.timeToNextWP(), m_MineEngagementPlanResult_ENU.timeToNextWP);
+        changed |= UpdateResultField(result.fRemainingTime(), m_MineEngagementPlanResult_ENU.RemainingTime);
+
+        changed |= UpdateResultField(result.sBatteryCapacity(), (short)m_MineEngagementPlanResult_ENU.BatteryCapacity_percentage);
+        changed |= UpdateResultField(result.fBatteryTime(), (float)m_MineEngagementPlanResult_ENU.BatteryTime_sec);
+
+        return changed;
+    }
+
+    bool MineEngagementManager::IsConvertedTrajectory(const GEO_POINT_2D& center) const
+    {
+        const std::vector<SPOINT_ENU>& trajectory = m_MineEngagementPlanResult_ENU.trajectory;
+        if (m_convertedTrajectoryCenter.latitude != center.latitude || m_convertedTrajectoryCenter.longitude != center.longitude
+            || m_convertedTrajectory.size() != trajectory.size())
+        {
+            return false;
         }
+        return std::equal(trajectory.begin(), trajectory.end(), m_convertedTrajectory.begin(),
+            [](const SPOINT_ENU& a, const SPOINT_ENU& b) { return a.E == b.E && a.N == b.N && a.U == b.U; });
     }
 
     // < 발사 전 > 교전계획 계산
@@ -179,21 +379,21 @@ namespace AIEP {
         m_MineEngagementPlanResult_ENU.resetTrajectoryInfo();
 
         m_MineEngagementPlanResult_ENU.BatteryCapacity_percentage = 100; // 실제 탄 연동 시에는 실제 축전량으로 반영해야 함
-        m_MineEngagementPlanResult_ENU.BatteryTime_sec = m_energyConsumtionperSec;
+        m_MineEngagementPlanResult_ENU.BatteryTime_sec = m_weaponSpec.energyConsumption_WhPerSec;
 
         int nextWaypointIdx{ m_MineEngagementPlanResult_ENU.idxOfNextWP };
         bool bDestinationReached = false;
         std::vector<SPOINT_ENU> fullTrajectory;
-        fullTrajectory.reserve(m_Max_sec_x10);
+        fullTrajectory.reserve(m_weaponSpec.maxRunSteps_x10);
 
         SPOINT_ENU LaunchPoint{ m_MineEngagementPlanResult_ENU.LaunchPoint.E, m_MineEngagementPlanResult_ENU.LaunchPoint.N , m_MineEngagementPlanResult_ENU.LaunchPoint.U };
         m_MineEngagementPlanResult_ENU.mslDRPos = LaunchPoint;
 
-        for (int i = 0; i < m_Max_sec_x10; i++)
+        for (int i = 0; i < m_weaponSpec.maxRunSteps_x10; i++)
         {
             int backup_next_wp_to_go = nextWaypointIdx;
 
-            // m_Max_sec_x10 값이 0.1 sec 단위 시간 기준임
+            // maxRunSteps_x10 값이 0.1 sec 단위 시간 기준임
             bDestinationReached = m_MineModel->runWaypoints(0.1, nextWaypointIdx, m_MineEngagementPlanResult_ENU.mslDRPos); // dead reckoning 미반영한 단위 시간 기동
 
             if (backup_next_wp_to_go != nextWaypointIdx) // WP reached and next wp updated
@@ -220,7 +420,7 @@ namespace AIEP {
             if (m_MineEngagementPlanResult_ENU.cachedPlanState != static_cast<int>(EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_ERROR))
             {
                 m_MineEngagementPlanResult_ENU.cachedPlanState = static_cast<int>(EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_ERROR);
-                DroppingPlanManager->updatePlanState(MINE_PLAN_FILE, m_dropPlanListNumber, m_dropPlanNumber, EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_ERROR);
+                DroppingPlanManager->updatePlanState(M_MineDroppingPlanManager::MINE_PLAN_FILE, m_dropPlanListNumber, m_dropPlanNumber, EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_ERROR, m_tubeNumber);
             }
         }
         else
@@ -230,14 +430,14 @@ namespace AIEP {
             if (m_MineEngagementPlanResult_ENU.cachedPlanState != static_cast<int>(EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_PLAN))
             {
                 m_MineEngagementPlanResult_ENU.cachedPlanState = static_cast<int>(EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_PLAN);
-                DroppingPlanManager->updatePlanState(MINE_PLAN_FILE, m_dropPlanListNumber, m_dropPlanNumber, EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_PLAN);
+                DroppingPlanManager->updatePlanState(M_MineDroppingPlanManager::MINE_PLAN_FILE, m_dropPlanListNumber, m_dropPlanNumber, EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_PLAN, m_tubeNumber);
             }
         }
 
         double step = static_cast<double>(fullTrajectory.size() - 1) / (m_weaponSpec.trajectoryArrayLength - 1);
 
         // 점 추출
-        for (size_t i = 0; i < m_weaponSpec.trajectoryArrayLength; ++i)
+        for (int i = 0; i < m_weaponSpec.trajectoryArrayLength; ++i)
         {
             size_t index = static_cast<size_t>(std::round(i * step));
             if (index >= fullTrajectory.size())
@@ -251,36 +451,44 @@ namespace AIEP {
     // < 발사 후 > 탄 위치 예측
     void MineEngagementManager::EstimateCurrentStatus()
     {
-        float ElapsedTimeafterLaunch{ m_MineEngagementPlanResult_ENU.timeSinceLaunch_sec };
+        // 산출 주기가 늦어지거나 당겨져도 위치가 시각과 어긋나지 않도록 발사 시각 기준 실제 경과 시간으로 적분
+        float ElapsedTimeafterLaunch = static_cast<float>(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - m_launchTime).count());
+        float StepTime_sec = ElapsedTimeafterLaunch - m_MineEngagementPlanResult_ENU.timeSinceLaunch_sec;
         int IdxofNextWP{ m_MineEngagementPlanResult_ENU.idxOfNextWP };
 
-        ElapsedTimeafterLaunch = ElapsedTimeafterLaunch + m_weaponSpec.engagementPlanUpdateInterval;
+        if (StepTime_sec <= 0.f)
+        {
+            return;
+        }
 
-        if (m_MineModel->runWaypoints(m_weaponSpec.engagementPlanUpdateInterval, IdxofNextWP, m_MineEngagementPlanResult_ENU.mslDRPos)) // 부설완료
+        if (m_MineModel->runWaypoints(StepTime_sec, IdxofNextWP, m_MineEngagementPlanResult_ENU.mslDRPos)) // 부설완료
         {
             m_MineEngagementPlanResult_ENU.RemainingTime = 0.;
 
             if (m_MineEngagementPlanResult_ENU.cachedPlanState != static_cast<int>(EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_FINISH))
             {
                 m_MineEngagementPlanResult_ENU.cachedPlanState = static_cast<int>(EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_FINISH);
-                DroppingPlanManager->updatePlanState(MINE_PLAN_FILE, m_dropPlanListNumber, m_dropPlanNumber, EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_FINISH);
+                DroppingPlanManager->updatePlanState(M_MineDroppingPlanManager::MINE_PLAN_FILE, m_dropPlanListNumber, m_dropPlanNumber, EN_M_MINE_PLAN_STATE::M_MINE_PLAN_STATE_FINISH, m_tubeNumber);
             }
         }
         else
         {
             // 축전 잔여량 계산
-            float InitialBatteryCapacity_Wh = (float)(m_InitialBatteryCapacity_percentage * M_MINE_MAX_BATTERY_CAPACITY_WH) / 100.; // [Wh]
+            float InitialBatteryCapacity_Wh = (float)(m_InitialBatteryCapacity_percentage * m_weaponSpec.batteryCapacity_Wh) / 100.; // [Wh]
 
             float totalEnergyConsumed_Wh{ m_MineEngagementPlanResult_ENU.TotalEnergyConsumed_Wh };
             float currentBatteryCapacity_Wh{ 0. };
 
-            totalEnergyConsumed_Wh = totalEnergyConsumed_Wh + m_energyConsumtionperSec * m_weaponSpec.engagementPlanUpdateInterval;
+            // 구간별 소모량을 누적해 두어야 잔여량이 발사 후 전체 소모량을 반영함
+            totalEnergyConsumed_Wh = totalEnergyConsumed_Wh + m_weaponSpec.energyConsumption_WhPerSec * StepTime_sec;
+            m_MineEngagementPlanResult_ENU.TotalEnergyConsumed_Wh = totalEnergyConsumed_Wh;
             currentBatteryCapacity_Wh = InitialBatteryCapacity_Wh - totalEnergyConsumed_Wh;
 
             if (InitialBatteryCapacity_Wh != 0)
             {
                 m_MineEngagementPlanResult_ENU.BatteryCapacity_percentage = (currentBatteryCapacity_Wh / InitialBatteryCapacity_Wh) * 100;
-                m_MineEngagementPlanResult_ENU.BatteryTime_sec = InitialBatteryCapacity_Wh / m_energyConsumtionperSec - ElapsedTimeafterLaunch;
+                m_MineEngagementPlanResult_ENU.BatteryTime_sec = InitialBatteryCapacity_Wh / m_weaponSpec.energyConsumption_WhPerSec - ElapsedTimeafterLaunch;
             }
             else
             {
@@ -306,7 +514,7 @@ namespace AIEP {
         m_MineEngagementPlanResult_ENU.bValidMslDRPos = 1;
     }
 
-    void MineEngagementManager::IsInValidLaunchGeometry()
+    bool MineEngagementManager::IsInValidLaunchGeometry()
     {
         GEO_POINT_2D center{ 0, };
         std::vector<SPOINT_WEAPON_ENU> localRoute;
@@ -316,14 +524,15 @@ namespace AIEP {
 
         {
             std::lock_guard<std::mutex> lockdata(m_dataMutex);
-            center.latitude = m_ownShipInfo.stShipMovementInfo().dShipLatitude();
-            center.longitude = m_ownShipInfo.stShipMovementInfo().dShipLongitude();
+            const NAVINF_SHIP_NAVIGATION_INFO& ownShip = *m_cycleInputs.ownShip;
+            center.latitude = ownShip.stShipMovementInfo().dShipLatitude();
+            center.longitude = ownShip.stShipMovementInfo().dShipLongitude();
 
             DataConverter::convertLatLonAltToLocal(
                 center, 
-                m_ownShipInfo.stShipMovementInfo().dShipLatitude(), 
-                m_ownShipInfo.stShipMovementInfo().dShipLongitude(), 
-                m_ownShipInfo.stUnderwaterEnvironmentInfo().fDivingDepth(), 
+                ownShip.stShipMovementInfo().dShipLatitude(), 
+                ownShip.stShipMovementInfo().dShipLongitude(), 
+                ownShip.stUnderwaterEnvironmentInfo().fDivingDepth(), 
                 OwnshipPos);
 
             localRoute.push_back(OwnshipPos); // 순서 중요
@@ -453,21 +662,23 @@ namespace AIEP {
             isInLaunchableArea.store(false);
         }
         SetLaunchPoint();
+        return isInLaunchableArea.load();
     }
 
     void MineEngagementManager::SetWaypoints()
     {
-        if (m_waypointCmd.stGeoWaypoints().unCntWaypoints() < 0 ||
-            m_waypointCmd.stGeoWaypoints().unCntWaypoints() > 8)
+        const CMSHCI_AIEP_WPN_GEO_WAYPOINTS& waypointCmd = *m_cycleInputs.waypoints;
+        if (waypointCmd.stGeoWaypoints().unCntWaypoints() < 0 ||
+            waypointCmd.stGeoWaypoints().unCntWaypoints() > 8)
         {
             return;
         }
         else
         {
             m_Geowaypoints.clear();
-            for (int i = 0; i < m_waypointCmd.stGeoWaypoints().unCntWaypoints(); i++)
+            for (int i = 0; i < waypointCmd.stGeoWaypoints().unCntWaypoints(); i++)
             {
-                m_Geowaypoints.push_back(m_waypointCmd.stGeoWaypoints().stGeoPos()[i]);
+                m_Geowaypoints.push_back(waypointCmd.stGeoWaypoints().stGeoPos()[i]);
             }
         }
 
@@ -478,9 +689,9 @@ namespace AIEP {
         if (isInLaunchableArea.load())
         {
             std::lock_guard<std::mutex> lock(m_dataMutex);
-            LaunchPos_Geo.dblLatitude() = m_ownShipInfo.stShipMovementInfo().dShipLatitude();
-            LaunchPos_Geo.dblLongitude() = m_ownShipInfo.stShipMovementInfo().dShipLongitude();
-            LaunchPos_Geo.fAltitude() = -m_ownShipInfo.stUnderwaterEnvironmentInfo().fDivingDepth();
+            LaunchPos_Geo.dblLatitude() = m_cycleInputs.ownShip->stShipMovementInfo().dShipLatitude();
+            LaunchPos_Geo.dblLongitude() = m_cycleInputs.ownShip->stShipMovementInfo().dShipLongitude();
+            LaunchPos_Geo.fAltitude() = -m_cycleInputs.ownShip->stUnderwaterEnvironmentInfo().fDivingDepth();
         }
         else
         {
@@ -493,6 +704,7 @@ namespace AIEP {
 
     void MineEngagementManager::SetAIWaypointInferenceRequestMessage(AIEP_INTERNAL_INFER_REQ& RequestMsg)
     {
+        auto paInfo = m_paInput.Load();     // 산출 주기 밖(추론 흐름)에서 호출되므로 최신 게시 값 사용
         std::lock_guard<std::mutex> lock(m_dataMutex);
         GEO_POINT_2D center;
 
@@ -510,22 +722,22 @@ namespace AIEP {
 
         RequestMsg.TargetCourse() = 0.;
         RequestMsg.TargetSpeed() = 0.;
-        RequestMsg.PaCount() = m_paInfo.nCountPA();
+        RequestMsg.PaCount() = paInfo->nCountPA();
 
         SPOINT_WEAPON_ENU PAPos_ENU;
         ST_PA_POINT_ENU PAInfo_ENU;
         std::array<ST_PA_POINT_ENU, 16> PAInfoArr_ENU;
         std::vector<ST_PA_POINT_ENU> PAInfoVec_ENU;
         float dummy{ 0. };
-        for (int i = 0; i < m_paInfo.nCountPA(); i++)
+        for (int i = 0; i < paInfo->nCountPA(); i++)
         {
-            DataConverter::convertLatLonAltToLocal(center, m_paInfo.stPaPoint()[i].dLatitude(), m_paInfo.stPaPoint()[i].dLongitude(), dummy, PAPos_ENU);
+            DataConverter::convertLatLonAltToLocal(center, paInfo->stPaPoint()[i].dLatitude(), paInfo->stPaPoint()[i].dLongitude(), dummy, PAPos_ENU);
             PAInfo_ENU.E() = PAPos_ENU.E;
             PAInfo_ENU.N() = PAPos_ENU.N;
             PAInfo_ENU.U() = PAPos_ENU.U;
-            PAInfo_ENU.speed() = m_paInfo.stPaPoint()[i].dSpeed();
-            PAInfo_ENU.course() = m_paInfo.stPaPoint()[i].dCourse();
-            PAInfo_ENU.radius() = m_paInfo.stPaPoint()[i].dRadius();
+            PAInfo_ENU.speed() = paInfo->stPaPoint()[i].dSpeed();
+            PAInfo_ENU.course() = paInfo->stPaPoint()[i].dCourse();
+            PAInfo_ENU.radius() = paInfo->stPaPoint()[i].dRadius();
 
             PAInfoVec_ENU.push_back(PAInfo_ENU);
         }
@@ -553,6 +765,14 @@ namespace AIEP {
         msg.eWpnKind() = static_cast<int32_t>(m_weaponKind);
         msg.stGeoWaypoints().unCntWaypoints() = AIWPInferReq.CountWaypoints() - 1; // AI 경로점의 마지막 point는 target 위치이므로 제거
 
+        // 대여 샘플에 남은 이전 경로점 제거
+        auto& geoPos = msg.stGeoWaypoints().stGeoPos();
+        int validCount = std::max(static_cast<int>(AIWPInferReq.CountWaypoints()) - 1, 0);
+        for (size_t i = validCount; i < geoPos.size(); i++)
+        {
+            geoPos[i] = {};
+        }
+
         for (int i = 0; i < AIWPInferReq.CountWaypoints() -1; i++)
         {
             msg.stGeoWaypoints().stGeoPos()[i].bValid() = 1;
@@ -569,6 +789,25 @@ namespace AIEP {
         }
     }
 
+    bool MineEngagementManager::CheckDropPlanFeasibility(const uint32_t listNum, const uint32_t planNum)
+    {
+        SAL_MINE_PLAN_FEASIBILITY feasibility{};
+        if (!DroppingPlanManager->getPlanFeasibility(listNum, planNum, feasibility))
+        {
+            return true; // 사전 검증 결과 없음, 교전계획 주기에서 판단
+        }
+
+        if (!feasibility.isFeasible())
+        {
+            DEBUG_WARNING_STREAM(ENGAGEMENT) << "Tube " << m_tubeNumber << " drop plan (List: " << listNum << ", Plan: " << planNum << ") infeasible -"
+                << " exists: " << feasibility.bPlanExists
+                << " range: " << feasibility.bWithinRange << " (" << feasibility.routeLength_m << " m)"
+                << " reached: " << feasibility.bDestinationReached << " (" << feasibility.time_to_destination << " sec)"
+                << " battery: " << feasibility.bBatterySufficient << " (" << feasibility.batteryAtDrop_percentage << " %)" << std::endl;
+        }
+        return feasibility.isFeasible();
+    }
+
     bool MineEngagementManager::IsValidAssignmentInfo(const ST_WA_SESSION& weaponAssignInfo)
     {
         if (weaponAssignInfo.usAllocDroppingPlanListNum() && weaponAssignInfo.usAllocLayNum())
@@ -587,6 +826,14 @@ namespace AIEP {
                 return false;
             }
 
+            // 사전 검증 결과로 존재하지 않는 부설계획은 파일 조회 없이 거부
+            SAL_MINE_PLAN_FEASIBILITY feasibility{};
+            if (DroppingPlanManager->getPlanFeasibility(newDropPlanListNum - 1, newDropPlanNum - 1, feasibility)
+                && !feasibility.bPlanExists)
+            {
+                return false;
+            }
+
             return true;
         }
         else
@@ -613,6 +860,7 @@ namespace AIEP {
         {
             DEBUG_ERROR_STREAM(ENGAGEMENT) << "Fail to update the drop plan " << std::endl;
         }
+        CheckDropPlanFeasibility(m_dropPlanListNumber, m_dropPlanNumber);
     }
 
     void MineEngagementManager::SetupDynamicsModel()
@@ -636,8 +884,8 @@ namespace AIEP {
             std::lock_guard<std::mutex> datalock(m_dataMutex);
             std::lock_guard<std::mutex> planlock(m_planMutex);
 
-            center.latitude = m_ownShipInfo.stShipMovementInfo().dShipLatitude();
-            center.longitude = m_ownShipInfo.stShipMovementInfo().dShipLongitude();        
+            center.latitude = m_cycleInputs.ownShip->stShipMovementInfo().dShipLatitude();
+            center.longitude = m_cycleInputs.ownShip->stShipMovementInfo().dShipLongitude();        
 
             // Launch Point 변환
             Latitude = LaunchPos_Geo.dblLatitude();
@@ -688,27 +936,34 @@ namespace AIEP {
         TargetPos_Geo.fAltitude() = Altitude;
     }
 
+    // 잠금 순서는 m_dataMutex → m_planMutex (SetupDynamicsModel, IsInValidLaunchGeometry)
+    // 여기서는 두 잠금을 동시에 보유하지 않음
     bool MineEngagementManager::LoadMineDropPlan(const uint32_t listNum, const uint32_t planNum) {
         ST_M_MINE_PLAN_INFO LoadedPlan;
-        std::lock_guard<std::mutex> lock(m_planMutex);
 
         // m_dropPlan에 부설계획 로드
         try
         {
             if (listNum >= 0 && planNum >= 0)
-                DroppingPlanManager->readDroppingPlanfromFile(MINE_PLAN_FILE, listNum, planNum, LoadedPlan);
+                DroppingPlanManager->readDroppingPlanfromFile(M_MineDroppingPlanManager::MINE_PLAN_FILE, listNum, planNum, LoadedPlan);
             else
                 return false;
 
             if (LoadedPlan.usDroppingPlanNumber() != 0) // 존재하는 부설계획인가?
             {
-                m_dropPlanLoaded = true;
-                m_dropPlan = LoadedPlan;
+                {
+                    std::lock_guard<std::mutex> lock(m_planMutex);
+                    m_dropPlanLoaded = true;
+                    m_dropPlan = LoadedPlan;
+                }
 
-                m_Geowaypoints.clear();
-                for (int i = 0; i < LoadedPlan.usWaypointCnt(); i++)
                 {
-                    m_Geowaypoints.push_back(LoadedPlan.stWaypoint()[i]);
+                    std::lock_guard<std::mutex> lock(m_dataMutex);
+                    m_Geowaypoints.clear();
+                    for (int i = 0; i < LoadedPlan.usWaypointCnt(); i++)
+                    {
+                        m_Geowaypoints.push_back(LoadedPlan.stWaypoint()[i]);
+                    }
                 }
 
                 SetTarget(LoadedPlan.stDropPos().dLatitude(), LoadedPlan.stDropPos().dLongitude(), -LoadedPlan.stDropPos().fDepth());
@@ -728,6 +983,7 @@ namespace AIEP {
         }
                    catch (const std::exception& e) {
             DEBUG_ERROR_STREAM(ENGAGEMENT) << "Mine drop plan setting Fail: " << e.what() << std::endl;
+            std::lock_guard<std::mutex> lock(m_planMutex);
             m_dropPlanLoaded = false;
 
             return false;
@@ -17,7 +17,9 @@ namespace AIEP {
     class MineEngagementManager : public EngagementManagerBase {
     public:
         MineEngagementManager(ST_WA_SESSION weaponAssignInfo, std::shared_ptr<AIEP::DdsComm> ddsComm);
-        ~MineEngagementManager() = default;
+        // 할당 전 사전 생성 (모델, 제원, 부설계획 변경 구독까지 준비)
+        MineEngagementManager(int tubeNumber, std::shared_ptr<AIEP::DdsComm> ddsComm);
+        ~MineEngagementManager();
 
     protected:
         // EngagementManagerBase 구현
@@ -28,7 +30,12 @@ namespace AIEP {
         void PlanTrajectory();
         void EstimateCurrentStatus();
 
-        void IsInValidLaunchGeometry() override;
+        // 교전계획 결과 메시지 갱신 (변경 여부 반환)
+        bool UpdateResultPlanFields(const GEO_POINT_2D& center);
+        bool UpdateResultStatusFields(const GEO_POINT_2D& center);
+        bool IsConvertedTrajectory(const GEO_POINT_2D& center) const;
+
+        bool IsInValidLaunchGeometry() override;
 
         void SetWaypoints() override;
         void SetLaunchPoint();
@@ -38,12 +45,12 @@ namespace AIEP {
         bool IsValidAssignmentInfo(const ST_WA_SESSION& weaponAssignInfo) override;
         bool IsAssignmentInfoChanged(const ST_WA_SESSION& weaponAssignInfo) override;
         void ApplyWeaponAssignmentInformation(const ST_WA_SESSION weaponAssignInfo) override;
+        bool PrepareAssignment(const ST_WA_SESSION& weaponAssignInfo) override;
 
 
 
     private:       
         // 멤버 변수
-        int m_Max_sec_x10{ 0 };
         std::atomic<bool> isInLaunchableArea{ false }; // 발사 가능 구역 내 자함 존재 여부
         SAL_MINE_EP_RESULT m_MineEngagementPlanResult_ENU; // 교전계획 산출 결과 coord: ENU
         std::vector<ST_WEAPON_WAYPOINT> m_Geowaypoints; //  경로점만 따로 관리 
@@ -60,6 +67,11 @@ namespace AIEP {
         // 부설계획 관리
         // ==========================================================================
         M_MineDroppingPlanManager* DroppingPlanManager;
+        int m_planChangeListenerId{ 0 };
+        std::atomic<bool> m_dropPlanEditPending{ false }; // 편집 통지 후 아직 다시 적재하지 않음 (산출 작업에서 적재)
+        void OnDropPlanEdited(int planListIndex, int planIndex); // 운용자 편집으로 부설계획이 변경된 경우
+        void SubscribePlanChanges();
+        bool LoadAssignedDropPlan(); // 할당된 부설계획 적재, 사전 검증 결과 조회, 할당 상태 기록, 모델 설정
         std::unique_ptr< M_MINE_Model> m_MineModel;
 
         // 부설계획 정보
@@ -72,15 +84,24 @@ namespace AIEP {
 
         bool LoadMineDropPlan(const uint32_t listNum, const uint32_t planNum); // json 파일에서 부설 계획 로드 후 m_dropPlan에 저장
         bool UpdateDropPlanWaypoints(const std::vector<ST_WEAPON_WAYPOINT>& waypoints); // 경로점 수정 명령으로 인한 경로점 수정
+        bool CheckDropPlanFeasibility(const uint32_t listNum, const uint32_t planNum); // 사전 검증 결과 조회 (부설계획 로드 시 산출)
 
-        // config.ini 내에서 무장제원으로 분리하면 더 좋음
-        const std::string MINE_PLAN_FILE = "Hello.json"; // 부설계획 파일 이름
-        const float M_MINE_MAX_BATTERY_CAPACITY_WH = 16941.47; // [Wh]
-        const float M_MINE_POWER_CONSUMPTION_COEFFICIENT_PER_HOUR = 3.9219; // [Wh/h/knot^3]
-
+        // ==========================================================================
+        // 교전계획 결과 송신 (산출 주기에서만 접근)
+        // ==========================================================================
+        AIEP_M_MINE_EP_RESULT m_resultMessage;              // 마지막으로 구성한 결과 (변경된 필드만 갱신)
+        std::vector<SPOINT_ENU> m_convertedTrajectory;      // m_resultMessage 궤적의 변환 원본 (같으면 재변환 생략)
+        GEO_POINT_2D m_convertedTrajectoryCenter{ 0, };
+        std::vector<ST_3D_GEODETIC_POSITION> m_geoTrajectory;
+        std::chrono::steady_clock::time_point m_lastResultSendTime{};
+        bool m_resultSent{ false };                         // false 이면 다음 주기에 전체 송신
+        bool m_resultStatusPending{ false };                // 송신되지 않은 상태 값 변경 존재
+        uint64_t m_resultSentCount{ 0 };
+        uint64_t m_resultSuppressedCount{ 0 };
+        uint64_t m_trajectoryConversionCount{ 0 };
+
+        // 축전지 제원과 초당 소모량은 무장 제원(config.ini)에서 로드 시 계산됨 (부설계획 사전 검증과 공유)
         const int m_InitialBatteryCapacity_percentage{ 100 };
-        const float m_initialBatteryCapacity_Wh{ (float)(m_InitialBatteryCapacity_percentage * M_MINE_MAX_BATTERY_CAPACITY_WH / 100.) }; // [Wh] 
-        const float m_energyConsumtionperSec{ float((M_MINE_POWER_CONSUMPTION_COEFFICIENT_PER_HOUR / 3600.f) * ((m_weaponSpec.maxSpeed_mps * MS2KN) * (m_weaponSpec.maxSpeed_mps * MS2KN) * (m_weaponSpec.maxSpeed_mps * MS2KN))) };
 
     };
 
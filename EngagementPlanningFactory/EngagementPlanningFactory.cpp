@@ -4,6 +4,8 @@
 #include "../Common/Utils/DebugPrint.h"
 #include "../Common/Utils/ConfigManager.h"
 
+#include <vector>
+
 namespace AIEP {
 
     // 지원되는 무장 종류들 정의
@@ -39,15 +41,15 @@ namespace AIEP {
 
 
         // ConfigManager에서 무장 지원 여부 확인
-        auto& configMgr = ConfigManager::GetInstance();
-        if (!configMgr.IsWeaponSupported(weaponKind)) {
+        auto config = ConfigManager::GetInstance().GetSnapshot();
+        if (!config->IsWeaponSupported(weaponKind)) {
             DEBUG_ERROR_STREAM(WEAPONFACTORY) << "Weapon kind not configured: "
                 << weaponKind << std::endl;
             return nullptr;
         }
 
         DEBUG_STREAM(WEAPONFACTORY) << "Creating EngagementManager for Tube " << tubeNumber
-            << ", Weapon: " << configMgr.GetWeaponName(weaponKind)
+            << ", Weapon: " << config->GetWeaponSpec(weaponKind).name
             << " (" << weaponKind << ")" << std::endl;
 
         try {
@@ -90,6 +92,129 @@ namespace AIEP {
         }
     }
 
+    bool EngagementPlanningFactory::Prewarm(int tubeNumber, uint32_t weaponKind, std::shared_ptr<AIEP::DdsComm> ddsComm) {
+        auto key = std::make_pair(tubeNumber, weaponKind);
+        std::vector<std::unique_ptr<IEngagementManager>> discarded;    // 해제는 잠금 밖에서
+        {
+            std::lock_guard<std::mutex> lock(m_prewarmMutex);
+            // 발사관당 적재 무장은 하나이므로 이전 적재 무장용 관리자는 폐기
+            for (auto it = m_prewarmed.begin(); it != m_prewarmed.end();) {
+                if (it->first.first == tubeNumber && it->first.second != weaponKind) {
+                    discarded.push_back(std::move(it->second));
+                    it = m_prewarmed.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            if (m_prewarmed.count(key) > 0) {
+                return true;
+            }
+        }
+        for (auto& stale : discarded) {
+            stale->Shutdown();
+        }
+        discarded.clear();
+
+        if (!ddsComm || !IsWeaponKindSupported(weaponKind) || !ConfigManager::GetInstance().IsWeaponSupported(weaponKind)) {
+            return false;
+        }
+
+        // 생성은 잠금 밖에서 (제원 로드, 모델 생성)
+        std::unique_ptr<IEngagementManager> manager = CreatePrewarmedManager(tubeNumber, weaponKind, ddsComm);
+        if (!manager) {
+            return false;
+        }
+
+        std::unique_ptr<IEngagementManager> duplicate;
+        {
+            std::lock_guard<std::mutex> lock(m_prewarmMutex);
+            auto& slot = m_prewarmed[key];
+            if (slot) {
+                duplicate = std::move(manager);     // 동시에 준비된 경우 하나만 유지 (해제는 잠금 밖에서)
+            }
+            else {
+                slot = std::move(manager);
+            }
+        }
+        if (duplicate) {
+            duplicate->Shutdown();
+        }
+
+        DEBUG_STREAM(WEAPONFACTORY) << "EngagementManager prewarmed for Tube " << tubeNumber
+            << ", Weapon: " << weaponKind << std::endl;
+        return true;
+    }
+
+    std::unique_ptr<IEngagementManager> EngagementPlanningFactory::AcquireEngagementManager(
+        ST_WA_SESSION weaponAssignInfo,
+        std::shared_ptr<AIEP::DdsComm> ddsComm) {
+
+        std::unique_ptr<IEngagementManager> manager;
+        {
+            std::lock_guard<std::mutex> lock(m_prewarmMutex);
+            auto it = m_prewarmed.find(std::make_pair(static_cast<int>(weaponAssignInfo.enTubeNum()),
+                static_cast<uint32_t>(weaponAssignInfo.enWeaponType())));
+            if (it != m_prewarmed.end()) {
+                manager = std::move(it->second);
+                m_prewarmed.erase(it);
+            }
+        }
+
+        if (manager) {
+            if (manager->BindAssignment(weaponAssignInfo)) {
+                return manager;
+            }
+            DEBUG_ERROR_STREAM(WEAPONFACTORY) << "Invalid assignment for prewarmed EngagementManager, Tube "
+                << weaponAssignInfo.enTubeNum() << std::endl;
+            manager->Shutdown();
+            return nullptr;
+        }
+
+        // 사전 생성 관리자가 없으면 할당 정보로 직접 생성 (계획 적재까지 호출 스레드에서 수행)
+        DEBUG_WARNING_STREAM(WEAPONFACTORY) << "No prewarmed EngagementManager for Tube " << weaponAssignInfo.enTubeNum()
+            << ", creating on assignment" << std::endl;
+        return CreateEngagementManager(weaponAssignInfo, ddsComm);
+    }
+
+    void EngagementPlanningFactory::DiscardPrewarmed(int tubeNumber) {
+        std::vector<std::unique_ptr<IEngagementManager>> discarded;
+        {
+            std::lock_guard<std::mutex> lock(m_prewarmMutex);
+            for (auto it = m_prewarmed.begin(); it != m_prewarmed.end();) {
+                if (it->first.first == tubeNumber) {
+                    discarded.push_back(std::move(it->second));
+                    it = m_prewarmed.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+        }
+
+        for (auto& manager : discarded) {
+            manager->Shutdown();
+        }
+    }
+
+    std::unique_ptr<IEngagementManager> EngagementPlanningFactory::CreatePrewarmedManager(
+        int tubeNumber, uint32_t weaponKind, std::shared_ptr<AIEP::DdsComm> ddsComm) {
+
+        try {
+            switch (static_cast<EN_WPN_KIND>(weaponKind)) {
+            case EN_WPN_KIND::WPN_KIND_M_MINE:
+                return std::make_unique<MineEngagementManager>(tubeNumber, ddsComm);
+
+            default:
+                return nullptr;     // 유도탄 관리자는 할당 시 생성
+            }
+        }
+        catch (const std::exception& e) {
+            DEBUG_ERROR_STREAM(WEAPONFACTORY) << "Failed to prewarm EngagementManager: " << e.what() << std::endl;
+            return nullptr;
+        }
+    }
+
     bool EngagementPlanningFactory::IsWeaponKindSupported(uint32_t weaponKind) const {
         return s_supportedWeaponKinds.find(weaponKind) != s_supportedWeaponKinds.end();
     }
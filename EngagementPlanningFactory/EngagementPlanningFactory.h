@@ -3,6 +3,8 @@
 #include <memory>
 #include <functional>
 #include <map>
+#include <mutex>
+#include <utility>
 
 #include "EngagementManagers/IEngagementManager.h"
 
@@ -19,6 +21,24 @@ namespace AIEP {
             std::shared_ptr<AIEP::DdsComm> ddsComm
         );
 
+        /**
+         * @brief 발사관/무장 종류별 관리자 사전 생성 (제원 로드, 모델 생성 등 할당과 무관한 초기화)
+         *        같은 발사관에 다른 무장 종류로 생성해 둔 관리자는 폐기
+         * @return 사전 생성 관리자가 준비되어 있으면 true (사전 생성을 지원하지 않는 무장이면 false)
+         */
+        bool Prewarm(int tubeNumber, uint32_t weaponKind, std::shared_ptr<AIEP::DdsComm> ddsComm);
+
+        /**
+         * @brief 할당용 관리자 획득 (사전 생성 관리자에 할당만 연결, 없으면 CreateEngagementManager)
+         */
+        std::unique_ptr<IEngagementManager> AcquireEngagementManager(
+            ST_WA_SESSION weaponAssignInfo,
+            std::shared_ptr<AIEP::DdsComm> ddsComm
+        );
+
+        // 발사관의 사전 생성 관리자 해제 (발사관 종료 시)
+        void DiscardPrewarmed(int tubeNumber);
+
         /**
          * @brief 무장 지원 여부 확인
          * @param weaponKind 무장 종류
@@ -47,6 +67,14 @@ namespace AIEP {
         std::unique_ptr<IEngagementManager> CreateMissileEngagementManager(
             ST_WA_SESSION weaponAssignInfo, std::shared_ptr<AIEP::DdsComm> ddsComm);
 
+        // 할당 정보 없이 생성 (현재 자항기뢰만 지원)
+        std::unique_ptr<IEngagementManager> CreatePrewarmedManager(
+            int tubeNumber, uint32_t weaponKind, std::shared_ptr<AIEP::DdsComm> ddsComm);
+
+        // (발사관 번호, 무장 종류) -> 할당 대기 중인 관리자
+        std::map<std::pair<int, uint32_t>, std::unique_ptr<IEngagementManager>> m_prewarmed;
+        std::mutex m_prewarmMutex;
+
         //static const std::set<EN_WPN_KIND> s_supportedWeaponKinds;
         bool IsWeaponKindSupported(uint32_t weaponKind) const;
 
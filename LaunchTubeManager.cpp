@@ -1,4 +1,5 @@
 #include "LaunchTubeManager.h"
+#include "EngagementPlanningFactory/EngagementManagers/M_MINE/M_MINE_DroppingPlanManager/M_MINE_DroppingPlanManager.h"
 
 //#include "Common/Utils/DebugPrint.h"
 
@@ -34,6 +35,17 @@ namespace AIEP {
         try {
             DEBUG_STREAM(LAUNCHTUBEMANAGER) << "Initializing LaunchTubeManager " << m_tubeNumber << std::endl;
 
+            // 이 프로세스의 발사관이 일으킨 부설계획 상태 전이는 변경된 목록을 AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST 로 송신 (담당 발사관만 구독)
+            // (편집/파일 재로드에 의한 전이(발사관 0)는 해당 처리에서 이미 송신)
+            if (IsPlanListOwner()) {
+                m_planStateListenerId = M_MineDroppingPlanManager::GetInstance().addPlanStateListener(
+                    [this](const M_MineDroppingPlanManager::PlanStateEvent& event) {
+                        if (event.tubeNumber != 0) {
+                            PublishChangedPlanLists();
+                        }
+                    });
+            }
+
             // 초기 상태 설정
             m_shutdown.store(false);
             m_initialized.store(true);
@@ -59,17 +71,89 @@ namespace AIEP {
 
         m_shutdown.store(true);
 
-        // 무장 할당 해제
+        // 무장 할당 해제 (m_mutex 보유 중이므로 잠금 없는 해제 사용)
         if (m_isAssigned) {
-            UnassignWeapon();
+            UnassignWeaponLocked();
+        }
+
+        // 미리 생성한 관리자 해제
+        if (m_spareWpnStatusCtrlManager) {
+            m_spareWpnStatusCtrlManager->Shutdown();
+            m_spareWpnStatusCtrlManager.reset();
         }
+        EngagementPlanningFactory::GetInstance().DiscardPrewarmed(m_tubeNumber);
+
+        auto assignLatency = m_assignLatency.GetSummary();
+        if (assignLatency.count > 0) {
+            DEBUG_STREAM(LAUNCHTUBEMANAGER) << "Tube " << m_tubeNumber << " weapon assignment time (us) over " << assignLatency.count << " assignments -"
+                << " p50: " << assignLatency.p50_us << " p99: " << assignLatency.p99_us << " max: " << assignLatency.max_us << std::endl;
+        }
+
+        M_MineDroppingPlanManager::GetInstance().removePlanStateListener(m_planStateListenerId);
         
         m_initialized.store(false);
         DEBUG_STREAM(LAUNCHTUBEMANAGER) << "LaunchTubeManager " << m_tubeNumber << " shutdown completed" << std::endl;
     }
 
     void LaunchTubeManager::UpdateLoadedWeaponKind(EN_WPN_KIND weaponKind) {
-        m_loadedWeaponKind.store(static_cast<uint32_t>(weaponKind));
+        uint32_t loadedKind = static_cast<uint32_t>(weaponKind);
+        if (m_loadedWeaponKind.exchange(loadedKind) == loadedKind) {
+            return;
+        }
+
+        // 적재 무장이 바뀌면 할당에 쓸 관리자를 미리 생성 (할당 명령 처리 시에는 연결만 수행)
+        PrewarmAssignmentResources(loadedKind);
+    }
+
+    void LaunchTubeManager::PrewarmAssignmentResources(uint32_t weaponKind) {
+        if (weaponKind == static_cast<uint32_t>(EN_WPN_KIND::WPN_KIND_NA)) {
+            return;
+        }
+
+        // 사전 생성끼리만 직렬화, 생성 작업 중에는 m_mutex 를 잡지 않음 (수신 처리/할당 명령이 대기하지 않도록)
+        std::lock_guard<std::mutex> prewarmLock(m_prewarmMutex);
+        auto isStillWanted = [this, weaponKind]() {
+            return !m_isAssigned && !m_shutdown.load() && m_loadedWeaponKind.load() == weaponKind;
+        };
+
+        bool needSpare;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!isStillWanted()) {
+                return;
+            }
+            needSpare = !m_spareWpnStatusCtrlManager || m_spareWpnStatusCtrlManager->GetWeaponKind() != weaponKind;
+        }
+
+        try {
+            std::unique_ptr<WpnStatusCtrlManager> spare;
+            if (needSpare) {
+                spare = std::make_unique<WpnStatusCtrlManager>(m_tubeNumber, weaponKind, m_ddsComm);
+            }
+            EngagementPlanningFactory::GetInstance().Prewarm(m_tubeNumber, weaponKind, m_ddsComm);
+
+            bool discardPrewarmed{ false };
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (isStillWanted()) {
+                    if (spare) {
+                        std::swap(spare, m_spareWpnStatusCtrlManager);     // 이전 관리자는 잠금 밖에서 해제
+                    }
+                }
+                else {
+                    discardPrewarmed = m_shutdown.load();   // 생성 중 종료되었으면 방금 준비한 관리자도 폐기
+                }
+            }
+            if (spare) {
+                spare->Shutdown();
+            }
+            if (discardPrewarmed) {
+                EngagementPlanningFactory::GetInstance().DiscardPrewarmed(m_tubeNumber);
+            }
+        }
+        catch (const std::exception& e) {
+            DEBUG_ERROR_STREAM(LAUNCHTUBEMANAGER) << "Failed to prewarm managers for Tube " << m_tubeNumber << ": " << e.what() << std::endl;
+        }
     }
 
     bool LaunchTubeManager::IsWeaponTypeCompatible(const TEWA_ASSIGN_CMD& assignCmd) const {
@@ -81,7 +165,7 @@ namespace AIEP {
     }
 
     bool LaunchTubeManager::AssignWeapon(const TEWA_ASSIGN_CMD& assignCmd) {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        std::unique_lock<std::mutex> lock(m_mutex);
 
         // 적재 정보와 일치하는 할당 명령인지 확인
         if (!IsWeaponTypeCompatible(assignCmd))
@@ -93,6 +177,7 @@ namespace AIEP {
         try {
             if (!m_isAssigned) // 할당
             {
+                auto assignStart = std::chrono::steady_clock::now();
                 m_weaponKind = assignCmd.stWpnAssign().enWeaponType();
                 ST_WA_SESSION AssignInfo;
                 AssignInfo = assignCmd.stWpnAssign();
@@ -101,15 +186,28 @@ namespace AIEP {
                 DEBUG_STREAM(LAUNCHTUBEMANAGER) << "Assigning weapon " << static_cast<int>(m_weaponKind)
                     << " to LaunchTube " << m_tubeNumber << std::endl;
 
-                // 1. 무장 상태 통제 관리자 생성
-                m_wpnStatusCtrlManager = std::make_unique<WpnStatusCtrlManager>(
-                    m_tubeNumber,
-                    m_weaponKind,
-                    m_ddsComm  // DDS 통신 주입
-                    );
+                // 1. 무장 상태 통제 관리자 (적재 시 미리 생성한 관리자 사용, 없으면 생성)
+                if (m_spareWpnStatusCtrlManager && m_spareWpnStatusCtrlManager->GetWeaponKind() == m_weaponKind) {
+                    m_wpnStatusCtrlManager = std::move(m_spareWpnStatusCtrlManager);
+                }
+                else {
+                    m_wpnStatusCtrlManager = std::make_unique<WpnStatusCtrlManager>(
+                        m_tubeNumber,
+                        m_weaponKind,
+                        m_ddsComm  // DDS 통신 주입
+                        );
+                }
 
-                // 2. 교전계획 관리자 생성
-                m_engagementManager = Factory.CreateEngagementManager(AssignInfo, m_ddsComm);
+                // 2. 교전계획 관리자 (미리 생성한 관리자에 할당 연결 및 부설계획 적재, 적재 실패 시 할당 거부)
+                m_engagementManager = Factory.AcquireEngagementManager(AssignInfo, m_ddsComm);
+                if (!m_engagementManager) {
+                    DEBUG_ERROR_STREAM(LAUNCHTUBEMANAGER) << "Failed to create EngagementManager for Tube " << m_tubeNumber << std::endl;
+                    m_wpnStatusCtrlManager->Shutdown();
+                    m_wpnStatusCtrlManager.reset();
+                    lock.unlock();
+                    PrewarmAssignmentResources(m_loadedWeaponKind.load());
+                    return false;
+                }
 
                 // 3. 콜백 함수들로 두 매니저 연결
                 DEBUG_STREAM(LAUNCHTUBEMANAGER) << "Connecting managers with callback functions..." << std::endl;
@@ -119,16 +217,20 @@ namespace AIEP {
                     OnWeaponLaunched(launchTime);
                     });
 
-                // ㄴWpnStatusCtrlManager가 교전계획 준비 상태를 확인할 수 있도록 체크 함수 주입
-                m_wpnStatusCtrlManager->SetEngagementPlanChecker([this]() {
-                    return m_engagementManager->IsEngagementPlanReady();
+                // ㄴEngagementManager → WpnStatusCtrlManager (교전계획 준비 상태 변경 통지, RTL 자동 전이)
+                WpnStatusCtrlManager* wpnStatusCtrl = m_wpnStatusCtrlManager.get();
+                m_engagementManager->SetPlanReadinessListener([wpnStatusCtrl](bool ready) {
+                    wpnStatusCtrl->OnEngagementPlanReadinessChanged(ready);
                     });
 
-                // 4. 교전계획 workerloop 시작
+                // 4. 상태 송신 및 교전계획 산출 주기 시작
+                m_wpnStatusCtrlManager->Activate();
                 m_engagementManager->StartEngagementPlanManager();
 
                 m_assignmentInfo = assignCmd;
                 m_isAssigned = true;
+
+                m_assignLatency.Record(std::chrono::steady_clock::now() - assignStart);
                 return true;
             }
             else // 할당 정보 변경
@@ -164,8 +266,23 @@ namespace AIEP {
     }
 
     bool LaunchTubeManager::UnassignWeapon() {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        bool unassigned;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_isAssigned) {
+                return true;
+            }
+            unassigned = UnassignWeaponLocked();
+        }
 
+        // 다음 할당에 쓸 관리자 다시 준비 (m_mutex 밖에서)
+        if (unassigned) {
+            PrewarmAssignmentResources(m_loadedWeaponKind.load());
+        }
+        return unassigned;
+    }
+
+    bool LaunchTubeManager::UnassignWeaponLocked() {
         if (!m_isAssigned) {
             return true;
         }
@@ -173,6 +290,7 @@ namespace AIEP {
         try {
             if ((m_wpnStatusCtrlManager->GetCurrentState() == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF) || m_shutdown.load())
             {
+                m_engagementManager->SetPlanReadinessListener(nullptr);
                 m_wpnStatusCtrlManager->Shutdown();
                 m_engagementManager->Shutdown();
 
@@ -253,13 +371,14 @@ namespace AIEP {
         }
     }
 
-    bool LaunchTubeManager::ProcessOwnshipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownshipInfo) {
+    bool LaunchTubeManager::ProcessOwnshipInfo(std::shared_ptr<const NAVINF_SHIP_NAVIGATION_INFO> ownshipInfo) {
+        // 항법 정보는 고빈도로 수신되므로 미할당 발사관은 기록 없이 무시
         if (!m_isAssigned || !m_engagementManager)
         {
-            DEBUG_ERROR_STREAM(LAUNCHTUBEMANAGER) << "No engagement plan manager assigned to process OwnshipInfo" << std::endl;
             return false;
         }
-        m_engagementManager->UpdateOwnShipInfo(ownshipInfo);
+        m_engagementManager->UpdateOwnShipInfo(std::move(ownshipInfo));
+        return true;
     }
 
     bool LaunchTubeManager::ProcessSystemTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& systemtargetInfo) {
@@ -310,6 +429,53 @@ namespace AIEP {
         return true;
     }
 
+    bool LaunchTubeManager::ProcessEditedPlanList(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& editedPlanList)
+    {
+        auto& planManager = M_MineDroppingPlanManager::GetInstance();
+
+        // 변경된 부설계획만 저장소와 파일에 반영 (할당된 교전계획 관리자는 변경 통지를 받음)
+        bool applied = planManager.applyEditedPlanList(editedPlanList, M_MineDroppingPlanManager::MINE_PLAN_FILE);
+        if (!applied)
+        {
+            DEBUG_ERROR_STREAM(LAUNCHTUBEMANAGER) << "Failed to apply edited mine plan list" << std::endl;
+        }
+
+        // 파일 기록에 실패해도 메모리에 반영된 목록은 송신
+        PublishChangedPlanLists();
+        return applied;
+    }
+
+    void LaunchTubeManager::OnPlanFileChanged(const std::string& path)
+    {
+        // 변경된 레코드만 저장소에 반영되고, 해당 부설계획이 할당된 교전계획 관리자에 통지됨
+        if (!M_MineDroppingPlanManager::GetInstance().reloadPlanStore(path))
+        {
+            DEBUG_ERROR_STREAM(LAUNCHTUBEMANAGER) << "Failed to reload mine plan file: " << path << std::endl;
+            return;
+        }
+
+        PublishChangedPlanLists();
+    }
+
+    void LaunchTubeManager::PublishChangedPlanLists()
+    {
+        // 담당 프로세스만 송신 (다른 프로세스의 전이는 파일 재로드로 반영된 뒤 송신됨)
+        if (!IsPlanListOwner())
+        {
+            return;
+        }
+
+        // 변경된 목록이 있을 때만 송신 (송신 캐시는 저장소가 보유하여 모든 발사관이 공유)
+        bool sent = M_MineDroppingPlanManager::GetInstance().publishChangedPlanLists(
+            [this](AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST& allPlanListMsg) {
+                allPlanListMsg.stMsgHeader().eTopicID() = static_cast<int32_t>(EN_TOPIC_ID::TOPIC_ID_AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST);
+                m_ddsComm->Send(allPlanListMsg);
+            });
+        if (sent)
+        {
+            DEBUG_STREAM(LAUNCHTUBEMANAGER) << "Sent: AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST" << std::endl;
+        }
+    }
 
     // ==========================================================================
     // 핵심 콜백 함수들 (매니저 간 상호작용 처리)
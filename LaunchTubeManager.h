@@ -3,6 +3,7 @@
 #include "EngagementPlanningFactory/EngagementPlanningFactory.h"
 #include "WpnStatusCtrl/WpnStatusCtrlManager.h"
 #include "dds_message/AIEP_AIEP_.hpp"
+#include "Common/Utils/LatencyRecorder.h"
 #include <memory>
 #include <mutex>
 #include <atomic>
@@ -18,6 +19,13 @@ namespace AIEP {
 		bool Initialize();
 		void Shutdown();
 
+		int GetTubeNumber() const { return m_tubeNumber; }
+
+		// 부설계획 편집 반영과 AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST 송신은 이 발사관을 운용하는 프로세스만 수행
+		// (다른 프로세스는 파일 변경 감시로 편집/상태 전이를 저장소에 반영)
+		static constexpr int PLAN_LIST_OWNER_TUBE = 1;
+		bool IsPlanListOwner() const { return m_tubeNumber == PLAN_LIST_OWNER_TUBE; }
+
 		// 적재정보 업데이트
 		void UpdateLoadedWeaponKind(EN_WPN_KIND weaponKind);
 
@@ -41,7 +49,7 @@ namespace AIEP {
 		bool ProcessWaypointCommand(const CMSHCI_AIEP_WPN_GEO_WAYPOINTS& command);
 
 		// 자함 정보
-		bool ProcessOwnshipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownshipInfo);
+		bool ProcessOwnshipInfo(std::shared_ptr<const NAVINF_SHIP_NAVIGATION_INFO> ownshipInfo);
 
 		// 시스템 표적 정보
 		bool ProcessSystemTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& systemtargetInfo);
@@ -51,7 +59,21 @@ namespace AIEP {
 
 		// AI 경로점 결과 후처리 후 전송
 		bool ProcessAIWaypointsInferenceResult(const AIEP_INTERNAL_INFER_RESULT_WP& command);
+
+		// 부설계획 편집 (변경분만 반영 후 변경된 목록만 재송신)
+		bool ProcessEditedPlanList(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& editedPlanList);
+
+		// 파일 변경 감지 (FileWatcher 스레드에서 호출)
+		void OnPlanFileChanged(const std::string& path);
 	private:
+		void PublishChangedPlanLists();
+
+		// 할당 해제 (m_mutex 보유 상태에서 호출)
+		bool UnassignWeaponLocked();
+
+		// 적재 무장용 관리자 사전 생성 (m_mutex 미보유 상태에서 호출)
+		void PrewarmAssignmentResources(uint32_t weaponKind);
+
 		// 멤버 변수
 		int m_tubeNumber;
 		std::shared_ptr<AIEP::DdsComm> m_ddsComm;
@@ -69,6 +91,14 @@ namespace AIEP {
 		std::unique_ptr<WpnStatusCtrlManager> m_wpnStatusCtrlManager;
 		std::unique_ptr<IEngagementManager> m_engagementManager;
 
+		// 할당 전 미리 생성한 무장 상태 통제 관리자 (교전계획 관리자는 EngagementPlanningFactory 에서 보관)
+		std::unique_ptr<WpnStatusCtrlManager> m_spareWpnStatusCtrlManager;
+		std::mutex m_prewarmMutex;	// 사전 생성 직렬화 (m_mutex 보다 먼저 잠금)
+		LatencyRecorder<256> m_assignLatency;	// 할당 명령 처리 시간
+
+		// 부설계획 상태 전이 구독 (송신 캐시는 M_MineDroppingPlanManager 가 보유)
+		int m_planStateListenerId{ 0 };
+
 		// 환경 정보
 		NAVINF_SHIP_NAVIGATION_INFO m_ownShipInfo;
 		std::map<uint32_t, TRKMGR_SYSTEMTARGET_INFO> m_targetInfoMap;
@@ -3,12 +3,35 @@
 
 namespace AIEP {
     TubeMessageReceiver::TubeMessageReceiver(int tubeNumber, LaunchTubeManager* launchtubemanager, std::shared_ptr<AIEP::DdsComm> ddsComm)
-        : m_tubeNumber(tubeNumber)
-        , m_launchtubemanager(launchtubemanager)
+        : TubeMessageReceiver(std::vector<LaunchTubeManager*>{ launchtubemanager }, ddsComm)
+    {
+    }
+
+    TubeMessageReceiver::TubeMessageReceiver(const std::vector<LaunchTubeManager*>& launchtubemanagers, std::shared_ptr<AIEP::DdsComm> ddsComm)
+        : m_tubeNumber(0)
         , m_ddsComm(ddsComm)
         , m_initialized(false)
         , m_shutdown(false)
     {
+        for (LaunchTubeManager* launchtubemanager : launchtubemanagers) {
+            if (!launchtubemanager) {
+                continue;
+            }
+            int tubeNumber = launchtubemanager->GetTubeNumber();
+            if (tubeNumber < 1) {
+                continue;
+            }
+            if (static_cast<size_t>(tubeNumber) >= m_tubeRoutes.size()) {
+                m_tubeRoutes.resize(tubeNumber + 1, nullptr);
+            }
+            m_tubeRoutes[tubeNumber] = launchtubemanager;
+            m_launchtubemanagers.push_back(launchtubemanager);
+        }
+
+        if (m_launchtubemanagers.size() == 1) {
+            m_tubeNumber = m_launchtubemanagers.front()->GetTubeNumber();
+        }
+
         Initialize();
     }
 
@@ -21,45 +44,61 @@ namespace AIEP {
             return true;
         }
 
-        if (!m_ddsComm || !m_launchtubemanager) {
+        if (!m_ddsComm || m_launchtubemanagers.empty()) {
             DEBUG_ERROR_STREAM(MESSAGERECEIVER) << "Invalid parameters for TubeMessageHandler initialization" << std::endl;
             return false;
         }
 
         try {
-            DEBUG_STREAM(MESSAGERECEIVER) << "Initializing TubeMessageHandler for Tube " << m_tubeNumber << std::endl;
+            DEBUG_STREAM(MESSAGERECEIVER) << "Initializing TubeMessageHandler for Tube " << m_tubeNumber
+                << " (" << m_launchtubemanagers.size() << " tube(s) in this process)" << std::endl;
+
+            // 발사관 지정 토픽은 이 프로세스가 운용하는 발사관만 콜백 처리 (수신/역직렬화는 모든 발사관, DdsComm 에서 생략 수 집계)
+            TubeCallbackFilter tubeFilter;
+            for (LaunchTubeManager* launchtubemanager : m_launchtubemanagers) {
+                tubeFilter.Allow(launchtubemanager->GetTubeNumber());
+            }
 
             // 적재정보 콜백 등록
             m_ddsComm->RegisterReader<TEWA_WA_TUBE_LOAD_INFO>(
-                [this](const TEWA_WA_TUBE_LOAD_INFO& msg) { OnLoadInfoReceived(msg); });
+                [this](const TEWA_WA_TUBE_LOAD_INFO& msg) { OnLoadInfoReceived(msg); },
+                tubeFilter, [](const TEWA_WA_TUBE_LOAD_INFO& msg) { return msg.eTubeNum(); });
 
             // DDS Reader 콜백 등록
             m_ddsComm->RegisterReader<TEWA_ASSIGN_CMD>(
-                [this](const TEWA_ASSIGN_CMD& msg) { OnAssignCommandReceived(msg); });
+                [this](const TEWA_ASSIGN_CMD& msg) { OnAssignCommandReceived(msg); },
+                tubeFilter, [](const TEWA_ASSIGN_CMD& msg) { return msg.stWpnAssign().enTubeNum(); });
 
             m_ddsComm->RegisterReader<CMSHCI_AIEP_PA_INFO>(
                 [this](const CMSHCI_AIEP_PA_INFO& msg) { OnPAInfoReceived(msg); });
 
             m_ddsComm->RegisterReader<CMSHCI_AIEP_WPN_CTRL_CMD>(
-                [this](const CMSHCI_AIEP_WPN_CTRL_CMD& msg) { OnWeaponControlCommandReceived(msg); });
+                [this](const CMSHCI_AIEP_WPN_CTRL_CMD& msg) { OnWeaponControlCommandReceived(msg); },
+                tubeFilter, [](const CMSHCI_AIEP_WPN_CTRL_CMD& msg) { return msg.eTubeNum(); });
 
             m_ddsComm->RegisterReader<CMSHCI_AIEP_WPN_GEO_WAYPOINTS>(
-                [this](const CMSHCI_AIEP_WPN_GEO_WAYPOINTS& msg) { OnWaypointsReceived(msg); });
+                [this](const CMSHCI_AIEP_WPN_GEO_WAYPOINTS& msg) { OnWaypointsReceived(msg); },
+                tubeFilter, [](const CMSHCI_AIEP_WPN_GEO_WAYPOINTS& msg) { return msg.eTubeNum(); });
 
             m_ddsComm->RegisterReader<NAVINF_SHIP_NAVIGATION_INFO>(
                 [this](const NAVINF_SHIP_NAVIGATION_INFO& msg) { OnOwnShipInfoReceived(msg); });
 
             m_ddsComm->RegisterReader<CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ>(
-                [this](const CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ& msg) { OnAIWaypointsInferenceRequestReceived(msg); });
+                [this](const CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ& msg) { OnAIWaypointsInferenceRequestReceived(msg); },
+                tubeFilter, [](const CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ& msg) { return msg.eTubeNum(); });
 
             m_ddsComm->RegisterReader<AIEP_INTERNAL_INFER_RESULT_WP>(
-                [this](const AIEP_INTERNAL_INFER_RESULT_WP& msg) { OnAIWaypointsInferenceResultReceived(msg); });
+                [this](const AIEP_INTERNAL_INFER_RESULT_WP& msg) { OnAIWaypointsInferenceResultReceived(msg); },
+                tubeFilter, [](const AIEP_INTERNAL_INFER_RESULT_WP& msg) { return msg.enTubeNum(); });
 
            m_ddsComm->RegisterReader<TRKMGR_SYSTEMTARGET_INFO>(
                 [this](const TRKMGR_SYSTEMTARGET_INFO& msg) { OnSystemTargetInfoReceived(msg); });
 
-            //m_ddsComm->RegisterReader<CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST>(
-            //    [this](const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& msg) { OnEditedPlanListReceived(msg); });
+            // 부설계획 편집은 담당 발사관을 운용하는 프로세스만 수신하여 파일에 반영 (다른 프로세스는 파일 변경 감시로 반영)
+            if (m_launchtubemanagers.front()->IsPlanListOwner()) {
+                m_ddsComm->RegisterReader<CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST>(
+                    [this](const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& msg) { OnEditedPlanListReceived(msg); });
+            }
 
             m_initialized.store(true);
 
@@ -86,19 +125,23 @@ namespace AIEP {
         DEBUG_STREAM(MESSAGERECEIVER) << "TubeMessageHandler for Tube " << m_tubeNumber << " shutdown completed" << std::endl;
     }
 
-    bool TubeMessageReceiver::IsMessageForThisTube(int messageTargetTube) const {
-        return messageTargetTube == m_tubeNumber;
+    LaunchTubeManager* TubeMessageReceiver::FindTube(int messageTargetTube) const {
+        if (messageTargetTube < 1 || static_cast<size_t>(messageTargetTube) >= m_tubeRoutes.size()) {
+            return nullptr;
+        }
+        return m_tubeRoutes[messageTargetTube];
     }
 
     void TubeMessageReceiver::OnLoadInfoReceived(const TEWA_WA_TUBE_LOAD_INFO& message)
     {
         int targetTube = static_cast<int>(message.eTubeNum());
 
-        if (!IsMessageForThisTube(targetTube)) {
+        LaunchTubeManager* launchtubemanager = FindTube(targetTube);
+        if (!launchtubemanager) {
             return;
         }
 
-        m_launchtubemanager->UpdateLoadedWeaponKind(
+        launchtubemanager->UpdateLoadedWeaponKind(
             static_cast<EN_WPN_KIND>(message.eWpnKind())
         );
     }
@@ -106,54 +149,37 @@ namespace AIEP {
     void TubeMessageReceiver::OnAssignCommandReceived(const TEWA_ASSIGN_CMD& message) {
         int targetTube = static_cast<int>(message.stWpnAssign().enTubeNum());
 
-        if (!IsMessageForThisTube(targetTube)) {
+        LaunchTubeManager* launchtubemanager = FindTube(targetTube);
+        if (!launchtubemanager) {
             return;
         }
 
-        DEBUG_STREAM(MESSAGERECEIVER) << "Tube " << m_tubeNumber << " received TEWA_ASSIGN_CMD" << std::endl;
+        DEBUG_STREAM(MESSAGERECEIVER) << "Tube " << targetTube << " received TEWA_ASSIGN_CMD" << std::endl;
 
         bool success{ false };
 
         try {
            if (message.eSetCmd() == static_cast<uint32_t>(EN_SET_CMD::SET_CMD_SET)) {
-                success = m_launchtubemanager->AssignWeapon(message);
+                success = launchtubemanager->AssignWeapon(message);
                 if (success) {
-                    AIEP_ASSIGN_RESP RespMsg;
-                    RespMsg.eSetCmd() = static_cast<uint32_t>(EN_SET_CMD::SET_CMD_SET);
-                    RespMsg.stWpnAssign() = message.stWpnAssign();
-                    RespMsg.stMsgHeader().eTopicID() = static_cast<int32_t>(EN_TOPIC_ID::TOPIC_ID_AIEP_ASSIGN_RESP);
-                    m_ddsComm->Send(RespMsg);
+                    SendAssignResponse(EN_SET_CMD::SET_CMD_SET, message);
                     DEBUG_STREAM(MESSAGERECEIVER) << "Sucessfully Sent: AIEP_ASSIGN_RESP - SET" << std::endl;
                 }
                 else
                 {
-                    AIEP_ASSIGN_RESP RespMsg;
-                    RespMsg.eSetCmd() = static_cast<uint32_t>(EN_SET_CMD::SET_CMD_REJECTED);
-                    RespMsg.stMsgHeader().eTopicID() = static_cast<int32_t>(EN_TOPIC_ID::TOPIC_ID_AIEP_ASSIGN_RESP);
-                    RespMsg.stWpnAssign() = message.stWpnAssign();
-
-                    m_ddsComm->Send(RespMsg);
+                    SendAssignResponse(EN_SET_CMD::SET_CMD_REJECTED, message);
                     DEBUG_ERROR_STREAM(MESSAGERECEIVER) << "Rejected to assign weapon" << std::endl;
                 }
             }
             else if (message.eSetCmd() == static_cast<uint32_t>(EN_SET_CMD::SET_CMD_UNSET)) {
-                success = m_launchtubemanager->UnassignWeapon();
+                success = launchtubemanager->UnassignWeapon();
                 if (success) {
-                    AIEP_ASSIGN_RESP RespMsg;
-                    RespMsg.eSetCmd() = static_cast<uint32_t>(EN_SET_CMD::SET_CMD_UNSET);
-                    RespMsg.stMsgHeader().eTopicID() = static_cast<int32_t>(EN_TOPIC_ID::TOPIC_ID_AIEP_ASSIGN_RESP);
-                    RespMsg.stWpnAssign() = message.stWpnAssign();
-
-                    m_ddsComm->Send(RespMsg);
+                    SendAssignResponse(EN_SET_CMD::SET_CMD_UNSET, message);
                     DEBUG_STREAM(MESSAGERECEIVER) << "Sucessfully Sent: AIEP_ASSIGN_RESP - UNSET" << std::endl;                    
                 }
                 else
                 {
-                    AIEP_ASSIGN_RESP RespMsg;
-                    RespMsg.eSetCmd() = static_cast<uint32_t>(EN_SET_CMD::SET_CMD_REJECTED);
-                    RespMsg.stWpnAssign() = message.stWpnAssign();
-                    RespMsg.stMsgHeader().eTopicID() = static_cast<int32_t>(EN_TOPIC_ID::TOPIC_ID_AIEP_ASSIGN_RESP);
-                    m_ddsComm->Send(RespMsg);
+                    SendAssignResponse(EN_SET_CMD::SET_CMD_REJECTED, message);
                     DEBUG_ERROR_STREAM(MESSAGERECEIVER) << "Rejected to unassign weapon" << std::endl;
                 }
             }
@@ -166,44 +192,63 @@ namespace AIEP {
         }
     }
 
+    // 할당 응답 송신 (Writer 송신 샘플을 대여하여 모든 필드 설정)
+    void TubeMessageReceiver::SendAssignResponse(EN_SET_CMD setCmd, const TEWA_ASSIGN_CMD& message)
+    {
+        auto RespMsg = m_ddsComm->LoanSample<AIEP_ASSIGN_RESP>();
+        RespMsg->eSetCmd() = static_cast<uint32_t>(setCmd);
+        RespMsg->stWpnAssign() = message.stWpnAssign();
+        RespMsg->stMsgHeader().eTopicID() = static_cast<int32_t>(EN_TOPIC_ID::TOPIC_ID_AIEP_ASSIGN_RESP);
+        m_ddsComm->Send(std::move(RespMsg));
+    }
+
     void TubeMessageReceiver::OnPAInfoReceived(const CMSHCI_AIEP_PA_INFO& message)
     {
-        m_launchtubemanager->ProcessPAInfo(message);
+        for (LaunchTubeManager* launchtubemanager : m_launchtubemanagers) {
+            launchtubemanager->ProcessPAInfo(message);
+        }
     }
 
     void TubeMessageReceiver::OnWeaponControlCommandReceived(const CMSHCI_AIEP_WPN_CTRL_CMD& message)
     {
         int targetTube = static_cast<int>(message.eTubeNum());
 
-        if (!IsMessageForThisTube(targetTube)) {
+        LaunchTubeManager* launchtubemanager = FindTube(targetTube);
+        if (!launchtubemanager) {
             return;
         }
-        m_launchtubemanager->ProcessWeaponControlCommand(message);
+        launchtubemanager->ProcessWeaponControlCommand(message);
     }
 
     void TubeMessageReceiver::OnWaypointsReceived(const CMSHCI_AIEP_WPN_GEO_WAYPOINTS& message)
     {
         int targetTube = static_cast<int>(message.eTubeNum());
 
-        if (!IsMessageForThisTube(targetTube)) {
+        LaunchTubeManager* launchtubemanager = FindTube(targetTube);
+        if (!launchtubemanager) {
             return;
         }
-        m_launchtubemanager->ProcessWaypointCommand(message);
+        launchtubemanager->ProcessWaypointCommand(message);
     }
 
     void TubeMessageReceiver::OnOwnShipInfoReceived(const NAVINF_SHIP_NAVIGATION_INFO& message)
     {
-        m_launchtubemanager->ProcessOwnshipInfo(message);
+        // 한 번 역직렬화된 자함 정보를 모든 발사관이 공유 (발사관별 복사 없이 같은 스냅샷 게시)
+        auto ownShip = std::make_shared<const NAVINF_SHIP_NAVIGATION_INFO>(message);
+        for (LaunchTubeManager* launchtubemanager : m_launchtubemanagers) {
+            launchtubemanager->ProcessOwnshipInfo(ownShip);
+        }
     }
 
     void TubeMessageReceiver::OnAIWaypointsInferenceRequestReceived(const CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ& message)
     {
         int targetTube = static_cast<int>(message.eTubeNum());
 
-        if (!IsMessageForThisTube(targetTube)) {
+        LaunchTubeManager* launchtubemanager = FindTube(targetTube);
+        if (!launchtubemanager) {
             return;
         }
-        m_launchtubemanager->ProcessAIWaypointsInferenceRequest(message);
+        launchtubemanager->ProcessAIWaypointsInferenceRequest(message);
     }
 
 
@@ -211,14 +256,23 @@ namespace AIEP {
     {
         int targetTube = static_cast<int>(message.enTubeNum());
 
-        if (!IsMessageForThisTube(targetTube)) {
+        LaunchTubeManager* launchtubemanager = FindTube(targetTube);
+        if (!launchtubemanager) {
             return;
         }
-        m_launchtubemanager->ProcessAIWaypointsInferenceResult(message);
+        launchtubemanager->ProcessAIWaypointsInferenceResult(message);
+    }
+
+    void TubeMessageReceiver::OnEditedPlanListReceived(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& message)
+    {
+        // 부설계획 저장소는 프로세스 공용이므로 한 번만 반영/송신
+        m_launchtubemanagers.front()->ProcessEditedPlanList(message);
     }
 
     void TubeMessageReceiver::OnSystemTargetInfoReceived(const TRKMGR_SYSTEMTARGET_INFO& message)
     {
-        m_launchtubemanager->ProcessSystemTargetInfo(message);
+        for (LaunchTubeManager* launchtubemanager : m_launchtubemanagers) {
+            launchtubemanager->ProcessSystemTargetInfo(message);
+        }
     }
 } // namespace AIEP
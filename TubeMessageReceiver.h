@@ -6,13 +6,16 @@
 #include <memory>
 #include <atomic>
 #include <chrono>
+#include <vector>
 
 namespace AIEP {
 	class LaunchTubeManager;
 
+	// 발사관 번호로 수신 메시지를 분배 (발사관별 프로세스는 1개, 단일 프로세스 모드는 전체 발사관)
 	class TubeMessageReceiver {
 	public:
 		TubeMessageReceiver(int tubeNumber, LaunchTubeManager* launchtubemanager, std::shared_ptr<AIEP::DdsComm> ddsComm);
+		TubeMessageReceiver(const std::vector<LaunchTubeManager*>& launchtubemanagers, std::shared_ptr<AIEP::DdsComm> ddsComm);
 		~TubeMessageReceiver();
 
 		// 초기화 및 종료
@@ -20,8 +23,8 @@ namespace AIEP {
 		void Shutdown();
 
 	private:
-		// 메시지 유효성 검사
-		bool IsMessageForThisTube(int messageTargetTube) const;
+		// 메시지 대상 발사관 조회 (이 프로세스가 운용하지 않는 발사관이면 nullptr)
+		LaunchTubeManager* FindTube(int messageTargetTube) const;
 
 		// DDS 메시지 수신 콜백들
 		void OnLoadInfoReceived(const TEWA_WA_TUBE_LOAD_INFO& message);
@@ -33,10 +36,15 @@ namespace AIEP {
 		void OnAIWaypointsInferenceRequestReceived(const CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ& message);
 		void OnAIWaypointsInferenceResultReceived(const AIEP_INTERNAL_INFER_RESULT_WP& message);
 		void OnSystemTargetInfoReceived(const TRKMGR_SYSTEMTARGET_INFO& message);
+		void OnEditedPlanListReceived(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& message);
+
+		// 할당 명령 응답 송신
+		void SendAssignResponse(EN_SET_CMD setCmd, const TEWA_ASSIGN_CMD& message);
 
 		// 멤버 변수
-		int m_tubeNumber;
-		LaunchTubeManager* m_launchtubemanager;
+		int m_tubeNumber;	// 로그용 (단일 프로세스 모드는 0)
+		std::vector<LaunchTubeManager*> m_launchtubemanagers;	// 공통 정보(자함, 표적, 금지구역) 전달 대상
+		std::vector<LaunchTubeManager*> m_tubeRoutes;			// 발사관 번호 -> 관리자 (O(1) 분배)
 		std::shared_ptr<AIEP::DdsComm> m_ddsComm;
 
 		std::atomic<bool> m_initialized;
@@ -1,19 +1,105 @@
 #include "WpnStatusCtrlManager.h"
 #include "../Common/Utils/ConfigManager.h"
+#include "../Common/Utils/TimerService.h"
+#include "../Common/Utils/RealTimeProfile.h"
+
+#include <algorithm>
+#include <array>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <poll.h>
+#include <unistd.h>
 
 namespace AIEP {
 
-    // 무장 상태 전이 규칙
-    const std::map<EN_WPN_CTRL_STATE, std::set<EN_WPN_CTRL_STATE>>
-        WpnStatusCtrlManager::s_validTransitions = {
-            {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON}},
-            {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON, {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF}},
-            {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL, {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF}},
-            {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH, {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT}},
-            {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT, {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF}},
-            {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH, {EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF}}
+    namespace {
+        using TransitionCause = WpnStatusCtrlManager::TransitionCause;
+
+        constexpr size_t kStateCount = 6;
+        constexpr size_t kInvalidStateIndex = kStateCount;
+
+        // 전이 규칙 행렬 인덱스 (IDL 열거값 순서에 의존하지 않음)
+        constexpr size_t StateIndex(EN_WPN_CTRL_STATE state) {
+            switch (state) {
+            case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF: return 0;
+            case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON: return 1;
+            case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL: return 2;
+            case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH: return 3;
+            case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH: return 4;
+            case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT: return 5;
+            default: return kInvalidStateIndex;
+            }
+        }
+
+        constexpr const char* kStateNames[kStateCount + 1] = { "OFF", "ON", "RTL", "LAUNCH", "POST_LAUNCH", "ABORT", "UNKNOWN" };
+
+        const char* CauseName(uint8_t cause) {
+            switch (static_cast<TransitionCause>(cause)) {
+            case TransitionCause::Command: return "command";
+            case TransitionCause::AutoRTL: return "auto RTL";
+            case TransitionCause::LaunchComplete: return "launch complete";
+            case TransitionCause::Shutdown: return "shutdown";
+            default: return "unknown";
+            }
+        }
+
+        struct TransitionRule {
+            EN_WPN_CTRL_STATE fromState;
+            EN_WPN_CTRL_STATE toState;
+            TransitionCause cause;
         };
 
+        // 무장 상태 전이 규칙 (전이별 허용 원인)
+        constexpr TransitionRule kTransitionRules[] = {
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON, TransitionCause::Command },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, TransitionCause::Command },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL, TransitionCause::AutoRTL },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH, TransitionCause::Command },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON, TransitionCause::Command },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, TransitionCause::Command },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH, TransitionCause::LaunchComplete },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, TransitionCause::Command },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, TransitionCause::Command },
+
+            // ABORT 명령은 모든 상태에서 즉시 적용
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT, TransitionCause::Command },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT, TransitionCause::Command },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT, TransitionCause::Command },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT, TransitionCause::Command },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT, TransitionCause::Command },
+
+            // 관리자 종료 시 모든 상태에서 OFF
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, TransitionCause::Shutdown },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, TransitionCause::Shutdown },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, TransitionCause::Shutdown },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, TransitionCause::Shutdown },
+            { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, TransitionCause::Shutdown }
+        };
+
+        using TransitionMatrix = std::array<std::array<uint8_t, kStateCount>, kStateCount>;
+
+        constexpr TransitionMatrix BuildTransitionMatrix() {
+            TransitionMatrix matrix{};
+            for (const auto& rule : kTransitionRules) {
+                matrix[StateIndex(rule.fromState)][StateIndex(rule.toState)] |= static_cast<uint8_t>(rule.cause);
+            }
+            return matrix;
+        }
+
+        // [현재 상태][목표 상태] = 허용 원인 비트
+        constexpr TransitionMatrix kTransitionMatrix = BuildTransitionMatrix();
+
+        constexpr bool Allows(EN_WPN_CTRL_STATE fromState, EN_WPN_CTRL_STATE toState, TransitionCause cause) {
+            return (kTransitionMatrix[StateIndex(fromState)][StateIndex(toState)] & static_cast<uint8_t>(cause)) != 0;
+        }
+
+        static_assert(Allows(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT, TransitionCause::Command), "LAUNCH must be abortable");
+        static_assert(!Allows(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, TransitionCause::Command), "LAUNCH must not be turned OFF without ABORT");
+        static_assert(!Allows(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL, TransitionCause::Command), "RTL is entered only when the engagement plan is ready");
+        static_assert(!Allows(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH, TransitionCause::Command)
+            && !Allows(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH, TransitionCause::Command), "POST_LAUNCH is entered only by the launch sequence");
+    }
+
     WpnStatusCtrlManager::WpnStatusCtrlManager(int tubeNumber, uint32_t weaponKind, std::shared_ptr<AIEP::DdsComm> ddsComm)
         : m_tubeNumber(tubeNumber)
         , m_weaponKind(weaponKind)
@@ -26,15 +112,61 @@ namespace AIEP {
             throw std::invalid_argument("DdsComm cannot be null");
         }
 
-        m_launchInProgress.store(false);
+        m_wakeEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_wakeEventFd < 0) {
+            throw std::runtime_error("eventfd creation failed");
+        }
+
+        // 발사 지연 타이머 (절대 시각, ns 해상도)
+        m_launchTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (m_launchTimerFd < 0) {
+            close(m_wakeEventFd);
+            throw std::runtime_error("timerfd creation failed");
+        }
+
         m_initialized.store(true);
 
-        m_wpnStatusCtrlThread = std::thread([this]() {WorkerLoop();}); // 생성과 동시에 loop 시작
+        m_wpnStatusCtrlThread = std::thread([this]() {WorkerLoop();}); // 생성과 동시에 loop 시작 (상태 송신은 Activate 이후)
 
         DEBUG_STREAM(WEAPONSTATE) << "WpnStatusCtrlManager initialized for Tube " << m_tubeNumber
             << ", Weapon Kind: " << static_cast<int>(m_weaponKind) << std::endl;
     }
 
+    void WpnStatusCtrlManager::Activate()
+    {
+        if (m_statusTimerId >= 0) {
+            return;
+        }
+
+        // 상태 송신 주기는 공용 타이머에서 관리 (만료 시 실행 스레드만 깨움)
+        auto config = ConfigManager::GetInstance().GetSnapshot();
+        const auto& businessConfig = config->businessLogic;
+        m_statusTimerId = TimerService::GetInstance().SchedulePeriodic(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(businessConfig.weaponStatusUpdateInterval_sec)),
+            [this](std::chrono::steady_clock::time_point) {
+                m_statusSendDue.store(true);
+                WakeWorker();
+            },
+            "WeaponStatus.Tube" + std::to_string(m_tubeNumber));
+        if (m_statusTimerId < 0) {
+            DEBUG_ERROR_STREAM(WEAPONSTATE) << "Weapon status timer registration failed for Tube " << m_tubeNumber << std::endl;
+            return;
+        }
+
+        // 송신 주기 설정 변경 시 타이머 주기만 변경 (송신은 멈추지 않음, 발사 지연은 발사 시점의 스냅샷 사용)
+        m_configSubscriptionId = ConfigManager::GetInstance().Subscribe([this](const ConfigChange& change) {
+            double interval_sec = change.current->businessLogic.weaponStatusUpdateInterval_sec;
+            if (!change.businessLogicChanged || interval_sec <= 0.0
+                || interval_sec == change.previous->businessLogic.weaponStatusUpdateInterval_sec) {
+                return;
+            }
+            TimerService::GetInstance().SetPeriod(m_statusTimerId,
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(interval_sec)));
+            DEBUG_STREAM(WEAPONSTATE) << "Tube " << m_tubeNumber << " weapon status interval: " << interval_sec << " sec" << std::endl;
+            });
+    }
+
     WpnStatusCtrlManager::~WpnStatusCtrlManager() {
         Shutdown();
     }
@@ -46,59 +178,155 @@ namespace AIEP {
 
         DEBUG_STREAM(WEAPONSTATE) << "WpnStatusCtrlManager shutdown for Tube " << m_tubeNumber << std::endl;
 
+        // 실행 스레드가 유일한 작업 스레드이므로 join 후에는 진행 중인 발사 절차나 RTL 확인이 남지 않음
+        ConfigManager::GetInstance().Unsubscribe(m_configSubscriptionId);
+        TimerService::GetInstance().Cancel(m_statusTimerId);
+
         m_shutdown.store(true);
-        m_abortRequested.store(true);
+        WakeWorker();
 
         if (m_wpnStatusCtrlThread.joinable()) {
             m_wpnStatusCtrlThread.join();
         }
 
-        int waitCount{ 0 };
+        close(m_wakeEventFd);
+        close(m_launchTimerFd);
+        m_wakeEventFd = -1;
+        m_launchTimerFd = -1;
 
-        m_currentState.store(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF);
+        // 실행 스레드 종료 후이므로 경합 없음 (규칙에 없는 상태면 강제 설정)
+        EN_WPN_CTRL_STATE currentState = m_currentState.load();
+        if (currentState != EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF
+            && !TryTransition(currentState, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, TransitionCause::Shutdown)) {
+            m_currentState.store(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF);
+        }
+        m_isWeaponOn.store(false);
+        LogTransitionJournal();
         
         // 콜백 함수들 정리
         {
             std::lock_guard<std::mutex> lock(m_callbackMutex);
-            m_isEngagementPlanReady = nullptr;
             m_onWeaponLaunched = nullptr;
         }
-        m_rtlCheckActive.store(false);
-        m_launchInProgress.store(false);
+
+        auto latency = m_commandLatency.GetSummary();
+        DEBUG_STREAM(WEAPONSTATE) << "Tube " << m_tubeNumber << " command latency (us) over " << latency.count << " commands -"
+            << " p50: " << latency.p50_us << " p90: " << latency.p90_us
+            << " p99: " << latency.p99_us << " max: " << latency.max_us << std::endl;
+
+        auto launchTiming = m_launchTimingError.GetSummary();
+        if (launchTiming.count > 0) {
+            DEBUG_STREAM(WEAPONSTATE) << "Tube " << m_tubeNumber << " launch timing error (us) over " << launchTiming.count << " launches -"
+                << " p50: " << launchTiming.p50_us << " p99: " << launchTiming.p99_us << " max: " << launchTiming.max_us << std::endl;
+        }
+
         m_initialized.store(false);
     }
 
     void WpnStatusCtrlManager::WorkerLoop()
     {
-        auto lastStatusSend = std::chrono::steady_clock::now();
+        using namespace std::chrono;
 
+        RealTimeProfile::ApplyCurrentThread("WeaponControl");
         DEBUG_STREAM(WEAPONSTATE) << "WorkerLoop started for Tube " << m_tubeNumber << std::endl;
 
         while (!m_shutdown.load()) {
-            auto now = std::chrono::steady_clock::now();
+            // 1. 명령 처리 (매 명령마다 ABORT 큐를 먼저 확인)
+            ControlCommand command;
+            while (!m_shutdown.load() && (m_abortLane.TryPop(command) || m_commandLane.TryPop(command))) {
+                ExecuteCommand(command);
+            }
 
-            // 1초마다 상태 송신
-            if (now - lastStatusSend >= std::chrono::seconds(1)) {
+            // 2. 발사 지연 시간 경과 시 발사 완료 (발사 타이머 만료로 깨어남)
+            if (m_launchInProgress && steady_clock::now() >= m_launchDeadline) {
+                CompleteLaunchSequence();
+            }
+
+            // 3. ON 상태에서 교전계획 준비 시 RTL 자동 전이 (준비 상태 변경 통지로 깨어남)
+            CheckForRTLTransition();
+
+            // 4. 상태 송신 주기 만료 (TimerService 통지)
+            if (m_statusSendDue.exchange(false)) {
                 SendWeaponStatus();
-                lastStatusSend = now;
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+            // 다음 할 일까지 대기 (명령/준비 상태/송신 주기 통지, 발사 타이머 만료 시 즉시 깨어남)
+            WaitForWork();
         }
 
         DEBUG_STREAM(WEAPONSTATE) << "WorkerLoop ended for Tube " << m_tubeNumber << std::endl;
     }
 
+    void WpnStatusCtrlManager::WaitForWork()
+    {
+        pollfd fds[2] = {
+            { m_wakeEventFd, POLLIN, 0 },
+            { m_launchTimerFd, POLLIN, 0 }
+        };
+
+        if (poll(fds, 2, -1) > 0) {
+            uint64_t count;
+            if (fds[0].revents & POLLIN) {
+                (void)read(m_wakeEventFd, &count, sizeof(count)); // 카운터 초기화
+            }
+            if (fds[1].revents & POLLIN) {
+                (void)read(m_launchTimerFd, &count, sizeof(count));
+            }
+        }
+    }
+
+    void WpnStatusCtrlManager::ArmLaunchTimer(std::chrono::steady_clock::time_point deadline)
+    {
+        // steady_clock 은 CLOCK_MONOTONIC 기준이므로 절대 시각으로 바로 설정
+        auto sinceEpoch = deadline.time_since_epoch();
+        auto sec = std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch);
+
+        struct itimerspec spec {};
+        spec.it_value.tv_sec = static_cast<time_t>(sec.count());
+        spec.it_value.tv_nsec = static_cast<long>(std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch - sec).count());
+        if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0) {
+            spec.it_value.tv_nsec = 1;
+        }
+
+        if (timerfd_settime(m_launchTimerFd, TFD_TIMER_ABSTIME, &spec, nullptr) < 0) {
+            DEBUG_ERROR_STREAM(WEAPONSTATE) << "Launch timer arm failed for Tube " << m_tubeNumber << std::endl;
+        }
+    }
+
+    void WpnStatusCtrlManager::DisarmLaunchTimer()
+    {
+        struct itimerspec spec {};
+        (void)timerfd_settime(m_launchTimerFd, 0, &spec, nullptr);
+    }
+
+    void WpnStatusCtrlManager::WakeWorker()
+    {
+        uint64_t one = 1;
+        (void)write(m_wakeEventFd, &one, sizeof(one));
+    }
+
     bool WpnStatusCtrlManager::ProcessControlCommand(const CMSHCI_AIEP_WPN_CTRL_CMD& command) {
-        if (!m_initialized.load()) {
+        if (!m_initialized.load() || m_shutdown.load()) {
             DEBUG_ERROR_STREAM(WEAPONSTATE) << "WpnStatusCtrlManager not initialized" << std::endl;
             return false;
         }
 
-        // 별도 스레드에서 상태 전이 처리
-        std::thread([this, command]() {
-            ProcessControlCommandInternal(command);
-            }).detach();
+        ControlCommand controlCommand;
+        controlCommand.targetState = static_cast<EN_WPN_CTRL_STATE>(command.eWpnCtrlCmd());
+        controlCommand.receivedTime = std::chrono::steady_clock::now();
+
+        // 실행 스레드 큐에 전달 (수신 순서대로 처리, ABORT 는 우선 처리)
+        bool queued = (controlCommand.targetState == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT)
+            ? m_abortLane.TryPush(controlCommand)
+            : m_commandLane.TryPush(controlCommand);
+
+        if (!queued) {
+            DEBUG_ERROR_STREAM(WEAPONSTATE) << "Command queue full for Tube " << m_tubeNumber
+                << ", command dropped: " << static_cast<int>(controlCommand.targetState) << std::endl;
+            return false;
+        }
 
+        WakeWorker();
         return true;
     }
 
@@ -106,20 +334,59 @@ namespace AIEP {
         return m_currentState.load();
     }
 
-    bool WpnStatusCtrlManager::IsValidTransition(EN_WPN_CTRL_STATE fromState, EN_WPN_CTRL_STATE toState) const {
-        auto it = s_validTransitions.find(fromState);
-        if (it == s_validTransitions.end()) {
+    bool WpnStatusCtrlManager::IsValidTransition(EN_WPN_CTRL_STATE fromState, EN_WPN_CTRL_STATE toState, TransitionCause cause) {
+        if (StateIndex(fromState) == kInvalidStateIndex || StateIndex(toState) == kInvalidStateIndex) {
             return false;
         }
+        return Allows(fromState, toState, cause);
+    }
 
-        return it->second.find(toState) != it->second.end();
+    bool WpnStatusCtrlManager::TryTransition(EN_WPN_CTRL_STATE& expected, EN_WPN_CTRL_STATE newState, TransitionCause cause) {
+        if (!IsValidTransition(expected, newState, cause)) {
+            return false;
+        }
+        if (!m_currentState.compare_exchange_strong(expected, newState, std::memory_order_acq_rel)) {
+            return false;
+        }
+        RecordTransition(expected, newState, cause);
+        return true;
     }
 
-    // LaunchTubeManager가 교전계획 준비 상태 체크 함수를 주입
-    void WpnStatusCtrlManager::SetEngagementPlanChecker(std::function<bool()> checker) {
-        std::lock_guard<std::mutex> lock(m_callbackMutex);
-        m_isEngagementPlanReady = checker;
-        DEBUG_STREAM(WEAPONSTATE) << "Engagement plan checker function injected for Tube " << m_tubeNumber << std::endl;
+    void WpnStatusCtrlManager::RecordTransition(EN_WPN_CTRL_STATE fromState, EN_WPN_CTRL_STATE toState, TransitionCause cause) {
+        m_transitionJournal.Record(static_cast<uint8_t>(StateIndex(fromState)), static_cast<uint8_t>(StateIndex(toState)),
+            static_cast<uint8_t>(cause));
+
+        DEBUG_STREAM(WEAPONSTATE) << "Tube " << m_tubeNumber << " state changed: "
+            << kStateNames[StateIndex(fromState)] << " -> " << kStateNames[StateIndex(toState)]
+            << " (" << CauseName(static_cast<uint8_t>(cause)) << ")" << std::endl;
+    }
+
+    void WpnStatusCtrlManager::LogTransitionJournal() {
+        auto entries = m_transitionJournal.Snapshot();
+        DEBUG_STREAM(WEAPONSTATE) << "Tube " << m_tubeNumber << " state transitions: " << m_transitionJournal.Count()
+            << " (last " << entries.size() << " shown)" << std::endl;
+
+        for (const auto& entry : entries) {
+            DEBUG_STREAM(WEAPONSTATE) << "  #" << entry.sequence << " +"
+                << std::chrono::duration<double>(entry.time - entries.front().time).count() << " s "
+                << kStateNames[std::min<size_t>(entry.fromState, kInvalidStateIndex)] << " -> "
+                << kStateNames[std::min<size_t>(entry.toState, kInvalidStateIndex)]
+                << " (" << CauseName(entry.cause) << ")" << std::endl;
+        }
+    }
+
+    // 교전계획 관리자가 준비 상태 변경 시점에 호출
+    void WpnStatusCtrlManager::OnEngagementPlanReadinessChanged(bool ready) {
+        if (m_engagementPlanReady.exchange(ready) == ready) {
+            return;
+        }
+
+        DEBUG_STREAM(WEAPONSTATE) << "Engagement plan " << (ready ? "ready" : "not ready")
+            << " for Tube " << m_tubeNumber << std::endl;
+
+        if (ready && !m_shutdown.load()) {
+            WakeWorker();
+        }
     }
 
     // LaunchTubeManager가 발사 완료 알림 콜백을 주입
@@ -129,36 +396,42 @@ namespace AIEP {
         DEBUG_STREAM(WEAPONSTATE) << "Launch completed notifier function injected for Tube " << m_tubeNumber << std::endl;
     }
 
-    void WpnStatusCtrlManager::ProcessControlCommandInternal(const CMSHCI_AIEP_WPN_CTRL_CMD& command) 
+    // 실행 스레드에서만 호출
+    void WpnStatusCtrlManager::ExecuteCommand(const ControlCommand& command) 
     {
-        EN_WPN_CTRL_STATE targetState = static_cast<EN_WPN_CTRL_STATE>(command.eWpnCtrlCmd());
+        EN_WPN_CTRL_STATE targetState = command.targetState;
 
         // ABORT 명령은 즉시 처리
         if (targetState == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT) 
         {
-            m_abortRequested.store(true);  // 발사 절차 중단 신호
+            if (m_launchInProgress) {
+                m_launchInProgress = false;  // 발사 절차 중단
+                DisarmLaunchTimer();
+                DEBUG_STREAM(WEAPONSTATE) << "Launch sequence aborted for Tube " << m_tubeNumber << std::endl;
+            }
             DEBUG_STREAM(WEAPONSTATE) << "ABORT " << std::endl;
-            m_currentState.store(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT);
-            return;
         }
         
+        // 규칙 확인과 전이를 CAS 로 묶음 (다른 전이가 먼저 적용되면 바뀐 상태 기준으로 다시 판정)
         EN_WPN_CTRL_STATE currentState = m_currentState.load();
-        
-        // 동일 상태면 성공으로 처리
-        if (currentState == targetState) {
-            DEBUG_STREAM(WEAPONSTATE) << "Already in target state: " << static_cast<int>(targetState) << std::endl;
-            return;
-        }
+        do {
+            // 동일 상태면 성공으로 처리
+            if (currentState == targetState) {
+                DEBUG_STREAM(WEAPONSTATE) << "Already in target state: " << static_cast<int>(targetState) << std::endl;
+                return;
+            }
 
-        // 상태 전이 유효성 검사
-        if (!IsValidTransition(currentState, targetState)) {
-            DEBUG_ERROR_STREAM(WEAPONSTATE) << "Invalid state transition: "
-                << static_cast<int>(currentState)
-                << " -> " << static_cast<int>(targetState) << std::endl;
-            return;
-        }
-        m_currentState.store(targetState);
-        
+            // 상태 전이 유효성 검사
+            if (!IsValidTransition(currentState, targetState, TransitionCause::Command)) {
+                DEBUG_ERROR_STREAM(WEAPONSTATE) << "Invalid state transition: "
+                    << static_cast<int>(currentState)
+                    << " -> " << static_cast<int>(targetState) << std::endl;
+                return;
+            }
+        } while (!m_currentState.compare_exchange_weak(currentState, targetState, std::memory_order_acq_rel));
+
+        RecordTransition(currentState, targetState, TransitionCause::Command);
+        RecordCommandLatency(command);
 
         // 무장 켬 후 경과 시간 저장
         if (targetState == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON)
@@ -166,73 +439,37 @@ namespace AIEP {
             m_weaponOnTime = std::chrono::steady_clock::now();
             m_isWeaponOn.store(true);
 
-            // ON 상태가 되면 RTL 전이 체크 시작
+            // 이미 교전계획이 준비되어 있으면 바로 RTL 전이
             CheckForRTLTransition();
         }
         else if (targetState == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF) 
         {
             m_isWeaponOn.store(false);
-            m_rtlCheckActive.store(false);
-
         }
         // 발사 명령인 경우 발사 절차 시작
         else if (targetState == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH) {
-            if (m_launchInProgress.exchange(true)) {
+            if (m_launchInProgress) {
                 DEBUG_STREAM(WEAPONSTATE) << "Launch already in progress" << std::endl;
                 return;
             }
-
-            std::thread([this]() { ProcessLaunchSequence(); }).detach();  // detached로 실행
+            StartLaunchSequence(command);
         }
         else {
             // 일반 상태 전이
         }
-
-    }
-
-    void WpnStatusCtrlManager::ChangeWeaponState(EN_WPN_CTRL_STATE newState) {
-        EN_WPN_CTRL_STATE previousState = m_currentState.exchange(newState);
-
-        DEBUG_STREAM(WEAPONSTATE) << "Tube " << m_tubeNumber << " state changed: "
-            << static_cast<int>(previousState) << " -> " << static_cast<int>(newState) << std::endl;
     }
 
+    // 실행 스레드에서 명령 처리 및 준비 상태 변경 통지 후 호출 (상태 변경은 실행 스레드만 수행)
     void WpnStatusCtrlManager::CheckForRTLTransition() {
-        // 이미 RTL 체크가 활성화되어 있으면 무시
-        if (m_rtlCheckActive.exchange(true)) {
+        if (!m_engagementPlanReady.load()) {
             return;
         }
 
-        std::thread([this]() {
-            DEBUG_STREAM(WEAPONSTATE) << "RTL transition check started for Tube " << m_tubeNumber << std::endl;
-
-            while (m_currentState.load() == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON &&
-                !m_shutdown.load() &&
-                m_rtlCheckActive.load()) {
-
-                // 콜백 함수로 교전계획 준비 상태 확인
-                bool planReady = false;
-                {
-                    std::lock_guard<std::mutex> lock(m_callbackMutex);
-                    if (m_isEngagementPlanReady) 
-                    {
-                        planReady = m_isEngagementPlanReady();
-                    }
-                }
-
-                if (planReady) {
-                    // 교전계획이 준비되었으면 RTL로 전이
-                    ChangeWeaponState(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL);
-                    DEBUG_STREAM(WEAPONSTATE) << "Auto transition to RTL for Tube " << m_tubeNumber << std::endl;
-                    break;
-                }
-
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            }
-
-            m_rtlCheckActive.store(false);
-            DEBUG_STREAM(WEAPONSTATE) << "RTL transition check ended for Tube " << m_tubeNumber << std::endl;
-            }).detach();
+        // 교전계획이 준비되었으면 RTL로 전이 (ON 상태일 때만 적용)
+        EN_WPN_CTRL_STATE expected = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+        if (TryTransition(expected, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL, TransitionCause::AutoRTL)) {
+            DEBUG_STREAM(WEAPONSTATE) << "Auto transition to RTL for Tube " << m_tubeNumber << std::endl;
+        }
     }
 
     void WpnStatusCtrlManager::SendWeaponStatus() {
@@ -241,24 +478,25 @@ namespace AIEP {
         }
 
         try {
-            AIEP_WPN_CTRL_STATUS_INFO statusMsg;
+            // Writer 송신 샘플을 대여하여 그 자리에서 채움 (모든 필드 설정)
+            auto statusMsg = m_ddsComm->LoanSample<AIEP_WPN_CTRL_STATUS_INFO>();
 
             // 기본 정보 설정
-            statusMsg.eTubeNum() = static_cast<uint32_t>(m_tubeNumber);
-            statusMsg.eCtrlState() = static_cast<uint32_t>(m_currentState.load());
+            statusMsg->eTubeNum() = static_cast<uint32_t>(m_tubeNumber);
+            statusMsg->eCtrlState() = static_cast<uint32_t>(m_currentState.load());
 
             // 무장 켠 후 경과시간 계산
             if (m_isWeaponOn.load()) {
                 auto now = std::chrono::steady_clock::now();
                 auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - m_weaponOnTime);
-                statusMsg.wpnTime() = static_cast<uint32_t>(elapsed.count());
+                statusMsg->wpnTime() = static_cast<uint32_t>(elapsed.count());
             }
             else {
-                statusMsg.wpnTime() = 0;
+                statusMsg->wpnTime() = 0;
             }
 
-            // DDS로 메시지 전송
-            m_ddsComm->Send(statusMsg);
+            // DDS로 메시지 전송 (샘플 반납)
+            m_ddsComm->Send(std::move(statusMsg));
 
             DEBUG_STREAM(WEAPONSTATE) << "Weapon status sent for Tube " << m_tubeNumber
                 << ", State: " << static_cast<int>(m_currentState.load()) << std::endl;
@@ -268,64 +506,64 @@ namespace AIEP {
         }
     }
 
-    void WpnStatusCtrlManager::ProcessLaunchSequence() {
-        try {
-            // ConfigManager에서 무장 스펙 조회
-            auto& configMgr = ConfigManager::GetInstance();
-            const auto& weaponSpec = configMgr.GetWeaponSpec(m_weaponKind);
-
-            double launchDelay_sec = weaponSpec.launchDelay_sec;
-
-            DEBUG_STREAM(WEAPONSTATE) << "Starting launch sequence for Tube " << m_tubeNumber
-                << ", Launch delay: " << launchDelay_sec << " seconds" << std::endl;
+    // 발사 지연 시간 후 실행 스레드에서 CompleteLaunchSequence 호출 (별도 스레드 없음)
+    void WpnStatusCtrlManager::StartLaunchSequence(const ControlCommand& command) {
+        // ConfigManager에서 무장 스펙 조회
+        auto config = ConfigManager::GetInstance().GetSnapshot();
+        const auto& weaponSpec = config->GetWeaponSpec(m_weaponKind);
 
-            auto startTime = std::chrono::steady_clock::now();
-            auto delayDuration = std::chrono::duration<double>(launchDelay_sec);
+        double launchDelay_sec = weaponSpec.launchDelay_sec;
 
-            while (!m_shutdown.load() && !m_abortRequested.load()) 
-            {
-                auto elapsed = std::chrono::steady_clock::now() - startTime;
-                if (elapsed >= delayDuration) {
-                    break;
-                }
+        DEBUG_STREAM(WEAPONSTATE) << "Starting launch sequence for Tube " << m_tubeNumber
+            << ", Launch delay: " << launchDelay_sec << " seconds" << std::endl;
 
-                // 짧은 간격으로 shutdown || abort 확인
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            }
+        // 지연 시간은 명령 수신 시각 기준 (큐 대기 시간이 발사 시점에 더해지지 않음)
+        m_launchRequestTime = command.receivedTime;
+        m_launchDeadline = command.receivedTime
+            + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(launchDelay_sec));
+        m_launchInProgress = true;
+        ArmLaunchTimer(m_launchDeadline);
+    }
 
-            // Shutdown or Abort이면 발사 절차 중단
-            if (m_shutdown.load() || m_abortRequested.load()) 
-            {
-                DEBUG_STREAM(WEAPONSTATE) << "Launch sequence aborted due to shutdown" << std::endl;
-                m_launchInProgress.store(false);
-                m_abortRequested.store(false); // 플래그 리셋
-                return;
-            }
+    void WpnStatusCtrlManager::CompleteLaunchSequence() {
+        m_launchInProgress = false;
 
-            // 발사 완료 - POST_LAUNCH 상태로 전이
-            {
-                std::lock_guard<std::mutex> lock(m_stateMutex);
-                m_currentState.store(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH);
+        // 발사 완료 - POST_LAUNCH 상태로 전이 (그 사이 ABORT 등으로 LAUNCH 를 벗어났으면 완료 처리하지 않음)
+        EN_WPN_CTRL_STATE expected = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH;
+        if (!TryTransition(expected, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH, TransitionCause::LaunchComplete)) {
+            DEBUG_WARNING_STREAM(WEAPONSTATE) << "Launch completion ignored for Tube " << m_tubeNumber
+                << ", state: " << static_cast<int>(expected) << std::endl;
+            return;
+        }
+        auto launchTime = std::chrono::steady_clock::now();
 
-                m_launchInProgress.store(false);
+        // 설정된 지연 시간 대비 실제 전이 시각 오차 기록
+        m_launchTimingError.Record(launchTime - m_launchDeadline);
+        DEBUG_STREAM(WEAPONSTATE) << "Launch sequence completed for Tube " << m_tubeNumber
+            << ", State transitioned to POST_LAUNCH - actual delay: "
+            << std::chrono::duration<double>(launchTime - m_launchRequestTime).count() << " sec, timing error: "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(launchTime - m_launchDeadline).count() << " ns" << std::endl;
 
-                DEBUG_STREAM(WEAPONSTATE) << "Launch sequence completed for Tube " << m_tubeNumber
-                    << ", State transitioned to POST_LAUNCH" << std::endl;
-            }
-            auto launchTime = std::chrono::steady_clock::now();
-            // 콜백 함수로 발사 완료 알림
-            {
-                std::lock_guard<std::mutex> lock(m_callbackMutex);
-                if (m_onWeaponLaunched) {
-                    m_onWeaponLaunched(launchTime);
-                    DEBUG_STREAM(WEAPONSTATE) << "Launch completed callback invoked for Tube " << m_tubeNumber << std::endl;
-                }
+        // 콜백 함수로 발사 완료 알림
+        try {
+            std::lock_guard<std::mutex> lock(m_callbackMutex);
+            if (m_onWeaponLaunched) {
+                m_onWeaponLaunched(launchTime);
+                DEBUG_STREAM(WEAPONSTATE) << "Launch completed callback invoked for Tube " << m_tubeNumber << std::endl;
             }
         }
         catch (const std::exception& e) {
-            DEBUG_ERROR_STREAM(WEAPONSTATE) << "Exception in launch sequence: " << e.what() << std::endl;
-            m_launchInProgress.store(false);
-            m_abortRequested.store(false);
+            DEBUG_ERROR_STREAM(WEAPONSTATE) << "Exception in launch completed callback: " << e.what() << std::endl;
         }
     }
+
+    void WpnStatusCtrlManager::RecordCommandLatency(const ControlCommand& command) {
+        m_commandLatency.Record(std::chrono::steady_clock::now() - command.receivedTime);
+
+        auto latency = m_commandLatency.GetSummary();
+        DEBUG_STREAM(WEAPONSTATE) << "Tube " << m_tubeNumber << " command-to-transition latency (us) -"
+            << " p50: " << latency.p50_us << " p90: " << latency.p90_us
+            << " p99: " << latency.p99_us << " max: " << latency.max_us
+            << " (" << latency.count << " commands)" << std::endl;
+    }
 } // namespace AIEP
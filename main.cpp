@@ -1,42 +1,67 @@
 
 #include <iostream>
 #include <memory>
+#include <vector>
 #include <thread>
 #include <chrono>
 #include <signal.h>
 
 #include "Common/Utils/DebugPrint.h"
 #include "Common/Utils/ConfigManager.h"
+#include "Common/Utils/FileWatcher.h"
+#include "Common/Utils/TimerService.h"
+#include "Common/Utils/WorkStealingPool.h"
+#include "Common/Utils/RealTimeProfile.h"
+#include "Common/Utils/ShutdownController.h"
 #include "Common/Communication/DdsComm.h"
 #include "LaunchTubeManager.h"
 #include "TubeMessageReceiver.h"
+#include "EngagementPlanningFactory/EngagementManagers/M_MINE/M_MINE_DroppingPlanManager/M_MINE_DroppingPlanManager.h"
 #include <cassert>
+#include <fstream>
 
 //int argc, char* argv[]
 int main() {
-    static std::unique_ptr<AIEP::LaunchTubeManager> g_launchTubemanager = nullptr;
+    static std::vector<std::unique_ptr<AIEP::LaunchTubeManager>> g_launchTubemanagers;
     static std::unique_ptr<AIEP::TubeMessageReceiver> g_messagereceiver = nullptr;
-    static std::atomic<bool> g_running(true);
 
     // 1. 전체 설정 로드 (한 번만)
     auto& config = AIEP::ConfigManager::GetInstance();
     bool configLoaded = config.LoadFromFile("config.ini");
     assert(configLoaded);
-    // 2. main에서는 시스템 인프라 설정만 관심
-    const auto& sysInfra = config.GetSystemInfraConfig();
+    // 2. main에서는 시작 시 스냅샷의 시스템 인프라 설정만 관심 (이후 다시 로드되어도 프로세스 구성은 유지)
+    auto startupConfig = config.GetSnapshot();
+    const auto& sysInfra = startupConfig->systemInfra;
 
     // 디버깅용 임시 선언7
     int tubeNumber = 1;//std::atoi(argv[1]);
 
+    // 단일 프로세스 모드: 전체 발사관을 하나의 DDS 참여자로 운용 (로그는 0번)
+    if (sysInfra.multiTubeProcess) {
+        tubeNumber = 0;
+    }
+
     DebugLogger::Initialize(tubeNumber);
 
+    // 로그 출력 수준은 실행 중 설정 변경 시 바로 반영
+    DebugLogger::SetMinimumLevel(startupConfig->logging.level);
+    int loggingSubscriptionId = config.Subscribe([](const AIEP::ConfigChange& change) {
+        if (change.loggingChanged) {
+            DebugLogger::SetMinimumLevel(change.current->logging.level);
+        }
+        });
+
+    // SIGINT/SIGTERM 은 main 스레드에서만 처리 (이후 생성되는 모든 스레드는 신호 차단 상태로 시작)
+    auto& shutdownController = AIEP::ShutdownController::GetInstance();
+    shutdownController.InstallSignalHandlers();
+
     //if (argc != 2) {
     //    std::cerr << "Usage: LaunchTubeProcess.exe <tube_number>" << std::endl;
     //    std::cerr << "Example: LaunchTubeProcess.exe 1" << std::endl;
     //    return 1;
     //}
 
-    if (tubeNumber < 1 || tubeNumber > sysInfra.totalTubes) {
+    if (!sysInfra.multiTubeProcess && (tubeNumber < 1 || tubeNumber > sysInfra.totalTubes)) {
 #ifdef CONSOLMESSAGE
         std::cerr << "Tube number must be between 1 and 6" << std::endl;
 #endif
@@ -44,31 +69,70 @@ int main() {
     }
 
 
-    DEBUG_STREAM(MAIN) << "Starting LaunchTubeProcess for Tube # " << tubeNumber << std::endl;
+    DEBUG_STREAM(MAIN) << "Starting LaunchTubeProcess for Tube # " << tubeNumber
+        << (sysInfra.multiTubeProcess ? " (all tubes)" : "") << std::endl;
 #ifdef CONSOLMESSAGE
     std::cout << "Starting LaunchTubeProcess for Tube " << tubeNumber << std::endl;
 #endif // CONSOLMESSAGE
 
     try {
+        // 실시간 실행 설정 ([RealTime] 섹션: 메모리 고정, 스레드별 우선순위/CPU 고정)
+        AIEP::RealTimeProfile::ApplyProcessProfile();
+        AIEP::RealTimeProfile::ApplyCurrentThread("Main");
+
+        // 공용 주기 타이머 시작 (무장 상태 송신, 교전계획 산출 주기)
+        auto& timerService = AIEP::TimerService::GetInstance();
+        timerService.Start();
+
+        // 교전계획 공용 작업 풀 시작 (모든 발사관의 산출 주기와 병렬 검증 작업을 실행)
+        auto& planningPool = AIEP::WorkStealingPool::GetInstance();
+        planningPool.Start(static_cast<size_t>(startupConfig->businessLogic.planningWorkerThreads));
+
         // DDS 통신 초기화
         auto ddsComm = std::make_shared<AIEP::DdsComm>(sysInfra.ddsDomainId);
 
         // 발사관 생성 및 초기화
-        g_launchTubemanager = std::make_unique<AIEP::LaunchTubeManager>(tubeNumber, ddsComm);
+        std::vector<AIEP::LaunchTubeManager*> launchTubes;
+        int firstTube = sysInfra.multiTubeProcess ? 1 : tubeNumber;
+        int lastTube = sysInfra.multiTubeProcess ? sysInfra.totalTubes : tubeNumber;
+        for (int tube = firstTube; tube <= lastTube; ++tube) {
+            g_launchTubemanagers.push_back(std::make_unique<AIEP::LaunchTubeManager>(tube, ddsComm));
+            launchTubes.push_back(g_launchTubemanagers.back().get());
+        }
 
-        // 메시지 핸들러 생성 및 초기화
-        g_messagereceiver = std::make_unique<AIEP::TubeMessageReceiver>(tubeNumber, g_launchTubemanager.get(), ddsComm);
+        // 메시지 핸들러 생성 및 초기화 (수신 샘플은 한 번만 역직렬화되어 발사관 번호로 분배)
+        g_messagereceiver = std::make_unique<AIEP::TubeMessageReceiver>(launchTubes, ddsComm);
 
         ddsComm->Start();
 
-        while (g_running.load())
-        {
-            // main 함수 종료 안되게 하는 loop
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-        }
+        // 부설계획 파일 및 설정 파일 변경 감시 (inotify, 주기적 디스크 확인 없음)
+        auto& fileWatcher = AIEP::FileWatcher::GetInstance();
+        // 부설계획 저장소와 설정은 프로세스 공용이므로 한 번만 다시 읽음
+        fileWatcher.Watch(AIEP::M_MineDroppingPlanManager::MINE_PLAN_FILE, [](const std::string& path) {
+            g_launchTubemanagers.front()->OnPlanFileChanged(path);
+            });
+        // 설정은 감시 스레드에서 다시 읽어 스냅샷 교체 후, 바뀐 항목의 구독자(교전계획 관리자, 상태 송신 주기, 로그 수준)에만 통지
+        fileWatcher.Watch("config.ini", [&config](const std::string& path) {
+            if (!config.LoadFromFile(path)) {
+                DEBUG_ERROR_STREAM(MAIN) << "Failed to reload configuration: " << path << " (keeping current settings)" << std::endl;
+            }
+            });
+        fileWatcher.Start();
+
+        // 종료 신호까지 대기 (eventfd, 주기적 깨어남 없음)
+        shutdownController.WaitForShutdownRequest();
         DEBUG_STREAM(MAIN) << "Shutting down systems..." << std::endl;
-        
+
+        // 공용 취소 토큰 취소 및 종료 제한 시간 감시 시작
+        shutdownController.BeginShutdown(std::chrono::milliseconds(sysInfra.shutdownTimeout_ms));
+
+        fileWatcher.Stop();
+        config.Unsubscribe(loggingSubscriptionId);
         ddsComm->Stop();
+        shutdownController.RecordStage("dds stopped");
+
+        // 발사관 콜백 필터로 처리를 생략한 샘플 수 (토픽별, 수신/역직렬화는 이미 수행됨)
+        DEBUG_STREAM(MAIN) << "Tube callback filter statistics:\n" << ddsComm->BuildCallbackFilterReport();
         
         // 정리 작업
         if (g_messagereceiver) {
@@ -76,12 +140,33 @@ int main() {
             g_messagereceiver.reset();
         }
 
-        if (g_launchTubemanager) {
-            g_launchTubemanager->Shutdown();
-            g_launchTubemanager.reset();
+        for (auto& launchTubemanager : g_launchTubemanagers) {
+            launchTubemanager->Shutdown();
         }
+        g_launchTubemanagers.clear();
+        shutdownController.RecordStage("launch tubes shut down");
+
+        // 발사관 종료 후 작업 풀 정지 (실행 중인 산출 작업은 각 관리자 종료 시 완료됨)
+        planningPool.Stop();
+        shutdownController.RecordStage("work pool stopped");
+
+        // 주기 지터 보고서 기록
+        auto currentConfig = config.GetSnapshot();
+        const auto& realTime = currentConfig->realTime;
+        if (!realTime.jitterReportFile.empty()) {
+            std::ofstream report(realTime.jitterReportFile);
+            report << timerService.BuildJitterReport();
+            DEBUG_STREAM(MAIN) << "Jitter report written to " << realTime.jitterReportFile << std::endl;
+        }
+
+        timerService.Stop();
+        shutdownController.RecordStage("timer stopped");
 
-        DEBUG_STREAM(MAIN) << "Shutdown completed for Tube " << tubeNumber << std::endl;
+        // 종료 요청(신호 수신)부터 완료까지 실제 소요 시간과 단계별 내역
+        auto timeToExit = shutdownController.CompleteShutdown();
+        DEBUG_STREAM(MAIN) << "Shutdown completed for Tube " << tubeNumber << " in "
+            << std::chrono::duration_cast<std::chrono::microseconds>(timeToExit).count() / 1000.0 << " ms\n"
+            << shutdownController.BuildStageReport() << std::flush;
         DebugLogger::Shutdown();
     }
     catch (const std::exception& e) {